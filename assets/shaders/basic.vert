@@ -45,10 +45,19 @@ layout (std140, binding = 1) uniform PointLights {
     int _pad1;
 };
 
+// ==================================
+// Storage Buffers
+// ==================================
+layout (std430, binding = 2) readonly buffer InstanceBuffer {
+    mat4 instanceModels[];
+};
+
 // ==================================
 // Required Uniforms
 // ==================================
 uniform mat4 u_model;
+// read the model matrix from the instance buffer instead of u_model
+uniform bool u_instanced;
 
 // ==================================
 // Material
@@ -92,12 +101,15 @@ out vec2 v_uv;
 
 void main()
 {
+    mat4 model = u_instanced ? instanceModels[gl_BaseInstance + gl_InstanceID] : u_model;
+    mat3 normalMatrix = mat3(transpose(inverse(model)));
+
     // matrix multiplication is right to left
-    v_position = vec3(u_model * vec4(a_position, 1.f));
+    v_position = vec3(model * vec4(a_position, 1.f));
     gl_Position = projectionView * vec4(v_position, 1.f);
 
-    v_normal = normalize(mat3(transpose(inverse(u_model))) * a_normal);
-    v_tangent = normalize(mat3(transpose(inverse(u_model))) * a_tangent);
-    v_bitangent = normalize(mat3(transpose(inverse(u_model))) * a_bitangent);
+    v_normal = normalize(normalMatrix * a_normal);
+    v_tangent = normalize(normalMatrix * a_tangent);
+    v_bitangent = normalize(normalMatrix * a_bitangent);
     v_uv = a_textureuv;
 }
@@ -0,0 +1,59 @@
+#include "Bench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+
+namespace siren::bench
+{
+static volatile u64 s_sink = 0;
+
+Vector<Benchmark>& Registry()
+{
+    static Vector<Benchmark> benchmarks{ };
+    return benchmarks;
+}
+
+bool Register(const std::string_view name, void (*run)())
+{
+    Registry().push_back(Benchmark{ name, run });
+    return true;
+}
+
+void Measure(
+    const std::string_view label,
+    const u32 repeats,
+    const std::function<void()>& setup,
+    const std::function<void()>& run
+)
+{
+    using Clock = std::chrono::steady_clock;
+
+    setup();
+    run(); // warm up caches and allocators
+
+    Vector<double> times;
+    times.reserve(repeats);
+    for (u32 i = 0; i < repeats; i++) {
+        setup();
+        const auto start = Clock::now();
+        run();
+        const auto end = Clock::now();
+        times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    std::ranges::sort(times);
+    std::cout << std::format(
+        "  {:<48} median {:>10.3f} ms   min {:>10.3f} ms\n",
+        label,
+        times[times.size() / 2],
+        times.front()
+    );
+}
+
+void Consume(const u64 value)
+{
+    s_sink = s_sink + value;
+}
+} // namespace siren::bench
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "utilities/spch.hpp"
+
+
+namespace siren::bench
+{
+/// @brief A benchmark function, registered via SIREN_BENCH().
+struct Benchmark
+{
+    std::string_view name;
+    void (*run)();
+};
+
+/// @brief Returns all registered benchmarks in registration order.
+Vector<Benchmark>& Registry();
+
+/// @brief Adds a benchmark to the registry, used by SIREN_BENCH().
+bool Register(std::string_view name, void (*run)());
+
+/**
+ * @brief Calls setup and then times run, repeats times after one untimed warm up, and prints the
+ * median and fastest wall time under label. setup is not timed, use it to rebuild state that run
+ * consumes.
+ */
+void Measure(
+    std::string_view label,
+    u32 repeats,
+    const std::function<void()>& setup,
+    const std::function<void()>& run
+);
+
+/// @brief Like Measure() above, for benchmarks that need no setup between runs.
+inline void Measure(
+    const std::string_view label,
+    const u32 repeats,
+    const std::function<void()>& run
+)
+{
+    Measure(label, repeats, [] { }, run);
+}
+
+/// @brief Keeps the compiler from optimizing away the computation of value.
+void Consume(u64 value);
+} // namespace siren::bench
+
+/// @brief Defines a benchmark function which the bench executable runs when its name matches the
+/// filter given on the command line.
+#define SIREN_BENCH(name)                                                                          \
+    static void name();                                                                            \
+    static const bool name##Registered = ::siren::bench::Register(#name, name);                    \
+    static void name()
@@ -0,0 +1,49 @@
+#include "DrawCommands.hpp"
+
+#include <random>
+
+
+namespace siren::bench
+{
+/// @brief The amount of materials the fake render state has room for.
+static constexpr u32 MAX_MATERIALS = 1024;
+
+/// @brief Backs the fake pointers, one byte per piece of render state.
+static Array<byte, 3 + MAX_MATERIALS> s_state{ };
+
+template <typename T>
+static T* fakeState(const size_t index)
+{
+    return reinterpret_cast<T*>(&s_state[index]);
+}
+
+Vector<core::DrawCommand> CreateDrawCommands(const DrawCommandParams& params)
+{
+    SirenAssert(params.materials <= MAX_MATERIALS, "Too many materials for the fake render state");
+
+    std::mt19937 random{ 42 };
+    std::uniform_real_distribution<float> depth{ 0.f, 10'000.f };
+    Vector<core::DrawCommand> commands;
+    commands.reserve(params.count);
+    for (u32 i = 0; i < params.count; i++) {
+        const u32 material = random() % params.materials;
+        const u32 geometry = random() % params.geometries;
+        commands.push_back(
+            {
+                .transformIndex = i,
+                .indexCount = 36 + geometry % 7 * 3,
+                .vertices = fakeState<core::Buffer>(0),
+                .indices = fakeState<core::Buffer>(1),
+                .pipeline = fakeState<core::GraphicsPipeline>(2),
+                .material = fakeState<core::Material>(3 + material),
+                .firstIndex = geometry * 1024,
+                .baseVertex = static_cast<i32>(geometry * 512),
+                .sortKey = params.sortKey(material, geometry, depth(random)),
+            }
+        );
+    }
+
+    if (params.sorted) { std::ranges::sort(commands, { }, &core::DrawCommand::sortKey); }
+    return commands;
+}
+} // namespace siren::bench
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "renderer/DrawCommand.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::bench
+{
+/// @brief Describes the commands created by CreateDrawCommands().
+struct DrawCommandParams
+{
+    u32 count;
+    u32 materials;
+    u32 geometries;
+    /// @brief Returns the sort key of a command from its material, geometry and depth.
+    std::function<u64(u32 material, u32 geometry, float depth)> sortKey;
+    /// @brief Whether the commands are ordered by their keys, like the draw queue after sorting,
+    /// or left in submission order.
+    bool sorted;
+};
+
+/**
+ * @brief Creates commands spread over random materials, geometries and depths, all drawn with one
+ * pipeline from one pair of buffers. The render state is only referred to by distinct fake
+ * pointers, which suffices for everything that merely compares commands, but must never be
+ * dereferenced.
+ */
+Vector<core::DrawCommand> CreateDrawCommands(const DrawCommandParams& params);
+} // namespace siren::bench
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "ecs/core/EntityHandle.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::bench
+{
+/**
+ * @brief The component storage the ECS used before archetypes, kept as the baseline for the
+ * storage benchmarks. Each component type lives in its own dense list which maps component handles
+ * to list indices, and each entity maps to an array of component handles, both through hash maps.
+ */
+class LegacyComponentStorage
+{
+public:
+    template <typename T, typename... Args>
+    T& emplace(const core::EntityHandle entity, Args&&... args)
+    {
+        const size_t componentIndex = typeIndex<T>();
+        auto& handles               = m_entityToComponent[entity];
+        List<T>& list               = getCreateList<T>();
+        if (handles[componentIndex] != INVALID) { return list.get(handles[componentIndex]); }
+
+        const u32 handle           = m_nextHandle++;
+        T& component               = list.emplace(handle, std::forward<Args>(args)...);
+        m_componentToIndex[handle] = componentIndex;
+        handles[componentIndex]    = handle;
+        return component;
+    }
+
+    void destroy(const core::EntityHandle entity)
+    {
+        const auto it = m_entityToComponent.find(entity);
+        if (it == m_entityToComponent.end()) { return; }
+
+        for (const u32 handle : it->second) {
+            if (handle == INVALID) { continue; }
+            m_lists[m_componentToIndex[handle]]->remove(handle);
+            m_componentToIndex.erase(handle);
+        }
+        m_entityToComponent.erase(it);
+    }
+
+    template <typename T>
+    T& get(const core::EntityHandle entity)
+    {
+        return getCreateList<T>().get(m_entityToComponent.at(entity)[typeIndex<T>()]);
+    }
+
+    template <typename T>
+    bool hasComponent(const core::EntityHandle entity) const
+    {
+        const auto it = m_entityToComponent.find(entity);
+        return it != m_entityToComponent.end() && it->second[typeIndex<T>()] != INVALID;
+    }
+
+    /// @brief Calls fn with each entity owning all of Ts, the way systems iterated before queries
+    /// existed: walk all entities and look up each component.
+    template <typename... Ts, typename Fn>
+    void each(Fn&& fn)
+    {
+        for (const auto& [entity, handles] : m_entityToComponent) {
+            if (((handles[typeIndex<Ts>()] == INVALID) || ...)) { continue; }
+            fn(getCreateList<Ts>().get(handles[typeIndex<Ts>()])...);
+        }
+    }
+
+private:
+    static constexpr u32 INVALID      = 0;
+    static constexpr size_t MAX_TYPES = 32;
+
+    struct IList
+    {
+        virtual ~IList()                = default;
+        virtual void remove(u32 handle) = 0;
+    };
+
+    template <typename T>
+    struct List final : IList
+    {
+        Vector<std::pair<u32, T>> components{ };
+        HashMap<u32, size_t> handleToIndex{ };
+
+        template <typename... Args>
+        T& emplace(const u32 handle, Args&&... args)
+        {
+            components.emplace_back(handle, T{ std::forward<Args>(args)... });
+            handleToIndex[handle] = components.size() - 1;
+            return components.back().second;
+        }
+
+        void remove(const u32 handle) override
+        {
+            const auto it = handleToIndex.find(handle);
+            if (it == handleToIndex.end()) { return; }
+
+            const size_t index = it->second;
+            handleToIndex.erase(it);
+            if (index != components.size() - 1) {
+                components[index]                      = std::move(components.back());
+                handleToIndex[components[index].first] = index;
+            }
+            components.pop_back();
+        }
+
+        T& get(const u32 handle) { return components[handleToIndex.at(handle)].second; }
+    };
+
+    Array<Own<IList>, MAX_TYPES> m_lists{ };
+    HashMap<core::EntityHandle, Array<u32, MAX_TYPES>> m_entityToComponent{ };
+    HashMap<u32, size_t> m_componentToIndex{ };
+    u32 m_nextHandle = 1;
+
+    template <typename T>
+    static size_t typeIndex()
+    {
+        static const size_t index = s_nextTypeIndex++;
+        return index;
+    }
+
+    static inline size_t s_nextTypeIndex = 0;
+
+    template <typename T>
+    List<T>& getCreateList()
+    {
+        Own<IList>& list = m_lists[typeIndex<T>()];
+        if (!list) { list = CreateOwn<List<T>>(); }
+        return static_cast<List<T>&>(*list);
+    }
+};
+} // namespace siren::bench
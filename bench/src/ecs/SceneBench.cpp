@@ -0,0 +1,104 @@
+#include "Bench.hpp"
+
+#include "ecs/components/TagComponent.hpp"
+#include "ecs/components/TransformComponent.hpp"
+#include "ecs/core/Scene.hpp"
+
+
+namespace siren::bench
+{
+namespace
+{
+constexpr size_t BULK_COUNT     = 100'000;
+constexpr size_t SNAPSHOT_COUNT = 50'000;
+constexpr u32 REPEATS           = 10;
+
+void createOneByOne(core::Scene& scene, const size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        const core::EntityHandle entity = scene.Create();
+        scene.Emplace<core::TransformComponent>(entity);
+        scene.Emplace<core::TagComponent>(entity, "enemy");
+    }
+}
+} // namespace
+
+/// Compares Scene::CreateMany() and Scene::DestroyMany() against creating and destroying the same
+/// entities one at a time.
+SIREN_BENCH(BulkCreateDestroy)
+{
+    Own<core::Scene> scene;
+    Vector<core::EntityHandle> entities;
+    const auto reset    = [&] { scene = CreateOwn<core::Scene>(); };
+    const auto populate = [&] {
+        scene    = CreateOwn<core::Scene>();
+        entities = scene->CreateMany(
+            BULK_COUNT,
+            core::TransformComponent{ },
+            core::TagComponent{ "enemy" }
+        );
+    };
+
+    Measure(
+        std::format("create {} one by one", BULK_COUNT),
+        REPEATS,
+        reset,
+        [&] { createOneByOne(*scene, BULK_COUNT); }
+    );
+    Measure(
+        std::format("CreateMany {}", BULK_COUNT),
+        REPEATS,
+        reset,
+        [&] {
+            entities = scene->CreateMany(
+                BULK_COUNT,
+                core::TransformComponent{ },
+                core::TagComponent{ "enemy" }
+            );
+        }
+    );
+
+    Measure(
+        std::format("destroy {} one by one", BULK_COUNT),
+        REPEATS,
+        populate,
+        [&] { for (const core::EntityHandle entity : entities) { scene->destroy(entity); } }
+    );
+    Measure(
+        std::format("DestroyMany {}", BULK_COUNT),
+        REPEATS,
+        populate,
+        [&] { scene->DestroyMany(entities); }
+    );
+}
+
+/// Measures Scene::Snapshot() and Scene::Restore() of a scene the size of a large level, with a
+/// shallow hierarchy so that it is copied as well.
+SIREN_BENCH(SnapshotRestore)
+{
+    core::Scene scene;
+    const Vector<core::EntityHandle> entities = scene.CreateMany(
+        SNAPSHOT_COUNT,
+        core::TransformComponent{ },
+        core::TagComponent{ "prop" }
+    );
+    for (size_t i = 1; i < entities.size(); i += 8) {
+        scene.SetParent(entities[i], entities[i - 1]);
+    }
+
+    Maybe<core::SceneSnapshot> snapshot;
+    Measure(
+        std::format("Snapshot {}", SNAPSHOT_COUNT),
+        REPEATS,
+        [&] { snapshot.emplace(scene.Snapshot()); }
+    );
+
+    Measure(
+        std::format("Restore {}", SNAPSHOT_COUNT),
+        REPEATS,
+        [&] { scene.DestroyMany(std::span(entities).first(SNAPSHOT_COUNT / 10)); },
+        [&] { scene.Restore(*snapshot); }
+    );
+    Consume(scene.getAll().size());
+}
+} // namespace siren::bench
@@ -0,0 +1,106 @@
+#include "Bench.hpp"
+
+#include "ecs/core/Scene.hpp"
+
+
+namespace siren::bench
+{
+namespace
+{
+constexpr u32 SYSTEM_COUNT    = 64;
+constexpr u32 COMPONENT_COUNT = 8;
+constexpr size_t ENTITY_COUNT = 20'000;
+
+struct Marker { };
+
+template <u32 K>
+struct Data
+{
+    float value = static_cast<float>(K);
+};
+
+/**
+ * @brief One of many systems writing a single component and reading two others, picked from I so
+ * that the systems form a dependency graph with both conflicting and independent neighbours. With
+ * DECLARED unset the same system runs exclusively, i.e. all systems run one after another.
+ */
+template <u32 I, bool DECLARED>
+class SyntheticSystem final : public core::System
+{
+    static constexpr u32 WRITE = I % COMPONENT_COUNT;
+    static constexpr u32 READ0 = (I * 3 + 1) % COMPONENT_COUNT;
+    static constexpr u32 READ1 = (I * 5 + 2) % COMPONENT_COUNT;
+
+public:
+    void onUpdate(const float delta, core::Scene& scene) override
+    {
+        scene.Each<Data<WRITE>, const Data<READ0>, const Data<READ1>>(
+            [delta] (Data<WRITE>& out, const Data<READ0>& a, const Data<READ1>& b) {
+                float value = out.value;
+                for (u32 i = 0; i < 8; i++) { value = value * 0.5f + (a.value - b.value) * delta; }
+                out.value = value;
+            }
+        );
+    }
+
+    core::SystemAccess getAccess() const override
+    {
+        if constexpr (!DECLARED) { return core::SystemAccess::Exclusive(); }
+        core::SystemAccess access{ };
+        access.write<Data<WRITE>>();
+        access.read<Data<READ0>, Data<READ1>>();
+        return access;
+    }
+};
+
+template <bool DECLARED, u32... Is>
+void startSystems(core::Scene& scene, std::integer_sequence<u32, Is...>)
+{
+    (scene.start<SyntheticSystem<Is, DECLARED>>(core::LogicPhase), ...);
+}
+
+template <bool DECLARED>
+Own<core::Scene> createScene()
+{
+    auto scene          = CreateOwn<core::Scene>();
+    const auto populate = [&scene] (const auto&... extra) {
+        scene->CreateMany(
+            ENTITY_COUNT / 2,
+            Data<0>{ },
+            Data<1>{ },
+            Data<2>{ },
+            Data<3>{ },
+            Data<4>{ },
+            Data<5>{ },
+            Data<6>{ },
+            Data<7>{ },
+            extra...
+        );
+    };
+    // two archetypes, so that queries span more than a single table
+    populate();
+    populate(Marker{ });
+    startSystems<DECLARED>(*scene, std::make_integer_sequence<u32, SYSTEM_COUNT>{ });
+    return scene;
+}
+} // namespace
+
+/// Stresses the system scheduler with many systems declaring overlapping component access, and
+/// compares it against running the same systems exclusively.
+SIREN_BENCH(SystemScheduler)
+{
+    const Own<core::Scene> declared  = createScene<true>();
+    const Own<core::Scene> exclusive = createScene<false>();
+
+    Measure(
+        std::format("{} systems, declared access", SYSTEM_COUNT),
+        50,
+        [&] { declared->onUpdate(0.016f); }
+    );
+    Measure(
+        std::format("{} systems, exclusive", SYSTEM_COUNT),
+        50,
+        [&] { exclusive->onUpdate(0.016f); }
+    );
+}
+} // namespace siren::bench
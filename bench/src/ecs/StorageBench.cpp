@@ -0,0 +1,135 @@
+#include "Bench.hpp"
+#include "LegacyComponentStorage.hpp"
+
+#include "ecs/components/IDComponent.hpp"
+#include "ecs/core/EntityManager.hpp"
+#include "ecs/core/Scene.hpp"
+
+#include <random>
+
+
+namespace siren::bench
+{
+namespace
+{
+struct Position
+{
+    float x = 0, y = 0, z = 0;
+};
+
+struct Velocity
+{
+    float x = 1, y = 2, z = 3;
+};
+
+/// @brief The archetype storage, populated through the scene like any game would.
+struct ArchetypeWorld
+{
+    Own<core::Scene> scene = CreateOwn<core::Scene>();
+    Vector<core::EntityHandle> entities{ };
+
+    void populate(const size_t count)
+    {
+        entities.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            const core::EntityHandle entity = scene->Create();
+            scene->Emplace<Position>(entity);
+            scene->Emplace<Velocity>(entity);
+            entities.push_back(entity);
+        }
+    }
+};
+
+/// @brief The hash map storage, populated the way the old Scene::Create() and Emplace() did.
+struct LegacyWorld
+{
+    core::EntityManager entityManager{ };
+    LegacyComponentStorage storage{ };
+    Vector<core::EntityHandle> entities{ };
+
+    void populate(const size_t count)
+    {
+        entities.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            const core::EntityHandle entity = entityManager.create();
+            storage.emplace<core::IDComponent>(entity, utilities::UUID::create());
+            storage.emplace<Position>(entity);
+            storage.emplace<Velocity>(entity);
+            entities.push_back(entity);
+        }
+    }
+};
+
+constexpr size_t ENTITY_COUNTS[] = { 1'000, 10'000, 100'000 };
+
+void integrate(Position& position, const Velocity& velocity)
+{
+    position.x += velocity.x * 0.016f;
+    position.y += velocity.y * 0.016f;
+    position.z += velocity.z * 0.016f;
+}
+} // namespace
+
+/**
+ * Compares the archetype storage against the old per type hash map layout: creating entities with
+ * two components, iterating both components and random access by entity.
+ */
+SIREN_BENCH(ArchetypeStorage)
+{
+    for (const size_t count : ENTITY_COUNTS) {
+        const u32 repeats = count >= 100'000 ? 10 : 50;
+
+        Own<ArchetypeWorld> archetype;
+        Own<LegacyWorld> legacy;
+        Measure(
+            std::format("create {} (archetype)", count),
+            repeats,
+            [&] { archetype = CreateOwn<ArchetypeWorld>(); },
+            [&] { archetype->populate(count); }
+        );
+        Measure(
+            std::format("create {} (hash map)", count),
+            repeats,
+            [&] { legacy = CreateOwn<LegacyWorld>(); },
+            [&] { legacy->populate(count); }
+        );
+
+        Measure(
+            std::format("iterate {} (archetype)", count),
+            repeats,
+            [&] { archetype->scene->Each<Position, const Velocity>(integrate); }
+        );
+        Measure(
+            std::format("iterate {} (hash map)", count),
+            repeats,
+            [&] { legacy->storage.each<Position, Velocity>(integrate); }
+        );
+
+        Vector<size_t> order(count);
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::shuffle(order, std::mt19937{ 42 });
+        Measure(
+            std::format("random get {} (archetype)", count),
+            repeats,
+            [&] {
+                float sum = 0;
+                for (const size_t i : order) {
+                    sum += archetype->scene->get<Position>(archetype->entities[i]).x;
+                }
+                Consume(static_cast<u64>(sum));
+            }
+        );
+        Measure(
+            std::format("random get {} (hash map)", count),
+            repeats,
+            [&] {
+                float sum = 0;
+                for (const size_t i : order) {
+                    sum += legacy->storage.get<Position>(legacy->entities[i]).x;
+                }
+                Consume(static_cast<u64>(sum));
+            }
+        );
+    }
+}
+} // namespace siren::bench
@@ -0,0 +1,100 @@
+#include "Bench.hpp"
+
+#include "ecs/components/TransformComponent.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+
+
+namespace siren::bench
+{
+namespace
+{
+constexpr size_t TRANSFORM_COUNT = 100'000;
+constexpr u32 REPEATS            = 50;
+
+/// @brief The transform as it was before rotations became quaternions, euler angles and a matrix
+/// rebuilt on every call.
+struct LegacyTransform
+{
+    glm::vec3 translation;
+    glm::vec3 rotation;
+    glm::vec3 scale;
+
+    glm::mat4 GetTransform() const
+    {
+        const glm::mat4 rotMat =
+                glm::rotate(glm::mat4(1.0f), rotation.x, glm::vec3(1, 0, 0)) *
+                glm::rotate(glm::mat4(1.0f), rotation.y, glm::vec3(0, 1, 0)) *
+                glm::rotate(glm::mat4(1.0f), rotation.z, glm::vec3(0, 0, 1));
+
+        return glm::translate(glm::mat4(1.0f), translation) * rotMat *
+                glm::scale(glm::mat4(1.0f), scale);
+    }
+};
+} // namespace
+
+/// Compares building the matrices of 100k transforms from euler angles on every call, as before,
+/// against calling UpdateTransform() on each dirty transform and against UpdateTransforms().
+SIREN_BENCH(TransformUpdate)
+{
+    std::mt19937 random{ 42 };
+    std::uniform_real_distribution<float> distribution{ -10.f, 10.f };
+    const auto randomVec = [&] {
+        return glm::vec3{ distribution(random), distribution(random), distribution(random) };
+    };
+
+    Vector<LegacyTransform> legacyTransforms;
+    Vector<core::TransformComponent> transforms;
+    legacyTransforms.reserve(TRANSFORM_COUNT);
+    transforms.reserve(TRANSFORM_COUNT);
+    for (size_t i = 0; i < TRANSFORM_COUNT; i++) {
+        const LegacyTransform& legacy = legacyTransforms.emplace_back(
+            randomVec(),
+            randomVec(),
+            glm::abs(randomVec()) + 0.1f
+        );
+        transforms.emplace_back(legacy.translation, legacy.rotation, legacy.scale);
+    }
+
+    Vector<core::TransformComponent*> pointers;
+    for (auto& transform : transforms) { pointers.push_back(&transform); }
+
+    // moving every transform a little marks all of them dirty again
+    const auto markDirty = [&] {
+        for (auto& transform : transforms) { transform.Translate(glm::vec3{ 0.001f }); }
+    };
+    const auto checksum = [&] {
+        float sum = 0;
+        for (const auto& transform : transforms) { sum += transform.GetTransform()[3][0]; }
+        Consume(static_cast<u64>(sum));
+    };
+
+    // the matrices are stored like the cached ones, so that all cases write the same memory
+    Vector<glm::mat4> legacyMatrices(TRANSFORM_COUNT);
+    Measure(
+        std::format("Euler GetTransform {}", TRANSFORM_COUNT),
+        REPEATS,
+        [&] {
+            for (size_t i = 0; i < TRANSFORM_COUNT; i++) {
+                legacyMatrices[i] = legacyTransforms[i].GetTransform();
+            }
+        }
+    );
+    Consume(static_cast<u64>(legacyMatrices.back()[3][0]));
+    Measure(
+        std::format("UpdateTransform {}", TRANSFORM_COUNT),
+        REPEATS,
+        markDirty,
+        [&] { for (auto& transform : transforms) { transform.UpdateTransform(); } }
+    );
+    checksum();
+    Measure(
+        std::format("UpdateTransforms {}", TRANSFORM_COUNT),
+        REPEATS,
+        markDirty,
+        [&] { core::TransformComponent::UpdateTransforms(pointers); }
+    );
+    checksum();
+}
+} // namespace siren::bench
@@ -0,0 +1,24 @@
+#include "Bench.hpp"
+#include "slog.hpp"
+#include "utilities/UUID.hpp"
+
+#include <iostream>
+
+/**
+ * Runs all registered benchmarks, or only those whose name contains the first argument. Build in
+ * release mode, debug builds are not representative.
+ */
+int main(const int argc, char* argv[])
+{
+    slog::logLevel = slog::Level::Warning;
+    siren::utilities::UUID::setSeed(69420);
+
+    const std::string_view filter = argc > 1 ? argv[1] : "";
+    for (const auto& [name, run] : siren::bench::Registry()) {
+        if (name.find(filter) == std::string_view::npos) { continue; }
+        std::cout << name << '\n';
+        run();
+    }
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include "Bench.hpp"
+#include "DrawCommands.hpp"
+
+#include <iostream>
+
+
+namespace siren::bench
+{
+namespace
+{
+constexpr u32 SURFACE_COUNT = 100'000;
+constexpr u32 REPEATS       = 50;
+
+/// @brief Creates commands over the given amount of materials and distinct geometries, ordered by
+/// material and geometry like the sorted draw queue.
+Vector<core::DrawCommand> createCommands(const u32 materials, const u32 geometries)
+{
+    return CreateDrawCommands(
+        {
+            .count = SURFACE_COUNT,
+            .materials = materials,
+            .geometries = geometries,
+            .sortKey = [] (const u32 material, const u32 geometry, float) {
+                return static_cast<u64>(material) << 32 | geometry;
+            },
+            .sorted = true,
+        }
+    );
+}
+} // namespace
+
+/// Measures how long building the instance matrices, indirect draws and batches of 100k surfaces
+/// takes, without a render context.
+SIREN_BENCH(IndirectDrawBuild)
+{
+    const Vector<glm::mat4> transforms(SURFACE_COUNT, glm::mat4{ 1.f });
+
+    Vector<glm::mat4> instances(SURFACE_COUNT);
+    Vector<core::DrawElementsIndirectCommand> indirect(SURFACE_COUNT);
+    Vector<core::DrawBatch> batches(SURFACE_COUNT);
+
+    const auto measure = [&] (const std::string& label, const Vector<core::DrawCommand>& commands) {
+        core::IndirectDrawCounts counts{ };
+        Measure(
+            label,
+            REPEATS,
+            [&] {
+                counts = core::BuildIndirectDraws(
+                    commands,
+                    transforms,
+                    instances,
+                    indirect,
+                    batches
+                );
+            }
+        );
+        std::cout << std::format(
+            "    {} indirect draws in {} batches\n",
+            counts.indirectDraws,
+            counts.batches
+        );
+    };
+
+    measure(
+        std::format("{} surfaces, 64 materials x 32 meshes", SURFACE_COUNT),
+        createCommands(64, 32)
+    );
+    measure(
+        std::format("{} surfaces, all unique", SURFACE_COUNT),
+        createCommands(64, SURFACE_COUNT)
+    );
+}
+} // namespace siren::bench
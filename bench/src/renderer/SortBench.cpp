@@ -0,0 +1,86 @@
+#include "Bench.hpp"
+#include "DrawCommands.hpp"
+
+#include "renderer/RenderSort.hpp"
+
+#include <iostream>
+
+
+namespace siren::bench
+{
+namespace
+{
+constexpr u32 REPEATS    = 10;
+constexpr u32 MATERIALS  = 64;
+constexpr u32 GEOMETRIES = 256;
+
+/// @brief Keys opaque commands like RenderModule::SubmitMesh() does.
+u64 opaqueSortKey(const u32 material, const u32 geometry, const float depth)
+{
+    return core::MakeSortKey(core::AlphaMode::Opaque, 0, material, geometry, depth);
+}
+
+/// @brief The order the draw queue was sorted in before sort keys, by comparing state pointers.
+bool comparePointers(const core::DrawCommand& left, const core::DrawCommand& right)
+{
+    if (left.pipeline != right.pipeline) { return left.pipeline < right.pipeline; }
+    if (left.material != right.material) { return left.material < right.material; }
+    if (left.vertices != right.vertices) { return left.vertices < right.vertices; }
+    if (left.indices != right.indices) { return left.indices < right.indices; }
+    if (left.firstIndex != right.firstIndex) { return left.firstIndex < right.firstIndex; }
+    return left.baseVertex < right.baseVertex;
+}
+
+/// @brief Returns how many indirect draws the sorted commands collapse into.
+u32 countInstanceRuns(const Vector<core::DrawCommand>& commands)
+{
+    u32 runs = 0;
+    for (size_t i = 0; i < commands.size(); i++) {
+        if (i == 0 || !commands[i].IsInstanceOf(commands[i - 1])) { runs++; }
+    }
+    return runs;
+}
+} // namespace
+
+/// Measures ordering the draw queue by packed keys with the radix sort, including gathering the
+/// commands into that order, against std::sort with the pointer comparator it replaced.
+SIREN_BENCH(DrawQueueSort)
+{
+    for (const u32 count : { 10'000u, 100'000u, 1'000'000u }) {
+        const Vector<core::DrawCommand> submitted = CreateDrawCommands(
+            {
+                .count = count,
+                .materials = MATERIALS,
+                .geometries = GEOMETRIES,
+                .sortKey = opaqueSortKey,
+                .sorted = false,
+            }
+        );
+        Vector<core::DrawCommand> queue;
+
+        Measure(
+            std::format("{} commands, comparator sort", count),
+            REPEATS,
+            [&] { queue = submitted; },
+            [&] { std::ranges::sort(queue, comparePointers); }
+        );
+        std::cout << std::format("    {} indirect draws\n", countInstanceRuns(queue));
+
+        core::RadixSorter sorter;
+        Vector<u64> keys;
+        Vector<u32> order;
+        Measure(
+            std::format("{} commands, radix sort", count),
+            REPEATS,
+            [&] { queue.clear(); },
+            [&] {
+                keys.clear();
+                for (const auto& cmd : submitted) { keys.push_back(cmd.sortKey); }
+                sorter.Sort(keys, order);
+                for (const u32 index : order) { queue.push_back(submitted[index]); }
+            }
+        );
+        std::cout << std::format("    {} indirect draws\n", countInstanceRuns(queue));
+    }
+}
+} // namespace siren::bench
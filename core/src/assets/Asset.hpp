@@ -17,6 +17,7 @@ enum class AssetType
     Texture2D,
     TextureCubeMap,
     GraphicsPipeline,
+    Prefab,
     // SCENE,
     // STATIC_MESH,
     // SCRIPT,
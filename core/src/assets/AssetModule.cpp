@@ -1,5 +1,6 @@
 #include "AssetModule.hpp"
 
+#include "ecs/core/Prefab.hpp"
 #include "filesystem/FileSystemModule.hpp"
 #include "geometry/Mesh.hpp"
 #include "importers/MeshImporter.hpp"
@@ -53,6 +54,20 @@ AssetHandle AssetModule::CreateBasicMaterial(const std::string& name)
     return handle;
 }
 
+AssetHandle AssetModule::CreatePrefab(const std::string& name)
+{
+    const Ref<Prefab> prefab = CreateRef<Prefab>(name);
+    const AssetHandle handle = AssetHandle::create();
+    const AssetMetaData metaData{ .type = AssetType::Prefab };
+
+    if (!m_registry.registerAsset(handle, prefab, metaData)) {
+        return AssetHandle::invalid();
+    }
+
+    trc("Created Prefab {}", handle);
+    return handle;
+}
+
 AssetHandle AssetModule::Import(const Path& path)
 {
     if (m_registry.isImported(path)) {
@@ -223,9 +238,9 @@ Ref<Mesh> AssetModule::GeneratePrimitive(const PrimitiveParams& params)
         {
             .transform = { 1 },
             .materialHandle = material,
-            .vertices = meshData->vertices,
-            .indices = meshData->indices,
-            .indexCount = meshData->indexCount,
+            .geometry = meshData->geometry,
+            .bounds = meshData->bounds,
+            .boundingSphere = meshData->boundingSphere,
         }
     );
 
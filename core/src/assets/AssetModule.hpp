@@ -28,6 +28,8 @@ public:
 
     /// @brief Creates and returns a default standard @ref Material.
     AssetHandle CreateBasicMaterial(const std::string& name = "Basic Material");
+    /// @brief Creates an empty @ref Prefab and returns its handle.
+    AssetHandle CreatePrefab(const std::string& name);
     /// @brief Imports an Asset using a filepath. Returns AssetHandle::invalid() on error.
     AssetHandle Import(const Path& path);
     /// @brief Helper function that both imports and returns an asset from a filepath. Returns nullptr on error.
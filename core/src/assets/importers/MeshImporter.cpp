@@ -261,8 +261,10 @@ void MeshImporter::loadMaterials()
 
 void MeshImporter::loadMeshes() const
 {
-    // creates and returns an index buffer for given mesh
-    auto createIndexBuffer = [] (const aiMesh* mesh) -> std::tuple<Ref<Buffer>, u32> {
+    // copies the vertices and indices of given mesh into the geometry arena, returns the
+    // allocation along with the bounds of its vertices
+    auto createGeometry =
+            [] (const aiMesh* mesh) -> std::tuple<Ref<GeometryAllocation>, AABB, BoundingSphere> {
         Vector<u32> indices;
 
         // iterate over all faces, which contain indices
@@ -273,11 +275,6 @@ void MeshImporter::loadMeshes() const
             }
         }
 
-        return { CreateRef<Buffer>(indices.data(), indices.size() * sizeof(u32), BufferUsage::Static), indices.size() };
-    };
-
-    // creates and returns a vertex buffer for given mesh
-    auto createVertexBuffer = [] (const aiMesh* mesh) -> Ref<Buffer> {
         VertexBufferBuilder vbb{ Renderer().GetPBRPipeline()->GetLayout() };
 
         for (i32 i = 0; i < mesh->mNumVertices; ++i) {
@@ -297,7 +294,8 @@ void MeshImporter::loadMeshes() const
             );
         }
 
-        return vbb.Build();
+        const AABB bounds = vbb.GetBounds();
+        return { vbb.Build(indices), bounds, vbb.GetBoundingSphere(bounds) };
     };
 
     // recursive function to traverse and load nodes of the mesh
@@ -311,9 +309,8 @@ void MeshImporter::loadMeshes() const
             // get the relevant mesh
             const aiMesh* mesh = m_scene->mMeshes[node->mMeshes[i]];
 
-            // create buffers and geometry
-            const auto [indexBuffer, indexCount] = createIndexBuffer(mesh);
-            const Ref<Buffer> vertexBuffer       = createVertexBuffer(mesh);
+            // create geometry
+            const auto [geometry, bounds, boundingSphere] = createGeometry(mesh);
 
             // fetch other surface related data
             const AssetHandle materialHandle = m_materials[mesh->mMaterialIndex];
@@ -322,9 +319,9 @@ void MeshImporter::loadMeshes() const
                 {
                     .transform = transform,
                     .materialHandle = materialHandle,
-                    .vertices = vertexBuffer,
-                    .indices = indexBuffer,
-                    .indexCount = indexCount,
+                    .geometry = geometry,
+                    .bounds = bounds,
+                    .boundingSphere = boundingSphere,
                 }
             );
         }
@@ -0,0 +1,142 @@
+#include "ThreadPool.hpp"
+
+
+namespace siren::core
+{
+/// @brief The pool the current thread is a worker of, and its queue index within that pool.
+static thread_local const ThreadPool* t_pool = nullptr;
+static thread_local u32 t_workerIndex        = 0;
+
+
+ThreadPool::ThreadPool(const u32 workerCount)
+{
+    m_queues.reserve(workerCount);
+    for (u32 i = 0; i < workerCount; i++) { m_queues.push_back(CreateOwn<JobQueue>()); }
+
+    m_workers.reserve(workerCount);
+    for (u32 i = 0; i < workerCount; i++) { m_workers.emplace_back([this, i] { workerLoop(i); }); }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock{ m_sleepMutex };
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+    for (auto& worker : m_workers) { worker.join(); }
+}
+
+ThreadPool& ThreadPool::Get()
+{
+    static ThreadPool pool{ std::max(std::thread::hardware_concurrency(), 2u) - 1 };
+    return pool;
+}
+
+void ThreadPool::submit(Job job)
+{
+    if (m_workers.empty()) {
+        job();
+        return;
+    }
+
+    const u32 index = getWorkerIndex().value_or(m_nextQueue++ % getWorkerCount());
+    {
+        std::lock_guard lock{ m_queues[index]->mutex };
+        m_queues[index]->jobs.push_back(std::move(job));
+    }
+    {
+        // the increment must not slip between a sleeping worker checking its predicate and
+        // starting to wait, otherwise the notification is lost
+        std::lock_guard lock{ m_sleepMutex };
+        m_queued++;
+    }
+    m_condition.notify_one();
+}
+
+void ThreadPool::parallelFor(
+    const size_t count,
+    const size_t grain,
+    const std::function<void(size_t, size_t)>& fn
+)
+{
+    if (count == 0) { return; }
+
+    const size_t pieceSize  = std::max<size_t>(grain, 1);
+    const size_t pieceCount = (count + pieceSize - 1) / pieceSize;
+    if (pieceCount == 1 || m_workers.empty()) {
+        fn(0, count);
+        return;
+    }
+
+    std::atomic<size_t> remaining{ pieceCount - 1 };
+    for (size_t piece = 1; piece < pieceCount; piece++) {
+        submit(
+            [&fn, &remaining, piece, pieceSize, count] {
+                fn(piece * pieceSize, std::min(count, (piece + 1) * pieceSize));
+                remaining.fetch_sub(1, std::memory_order_acq_rel);
+            }
+        );
+    }
+
+    fn(0, pieceSize);
+
+    // help out instead of blocking, the pieces may be stuck behind other jobs
+    const u32 index = getWorkerIndex().value_or(0);
+    Job job;
+    while (remaining.load(std::memory_order_acquire) > 0) {
+        if (tryTake(index, job)) {
+            job();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void ThreadPool::workerLoop(const u32 index)
+{
+    t_pool        = this;
+    t_workerIndex = index;
+
+    Job job;
+    while (true) {
+        if (tryTake(index, job)) {
+            job();
+            continue;
+        }
+
+        std::unique_lock lock{ m_sleepMutex };
+        m_condition.wait(lock, [this] { return m_stopping || m_queued > 0; });
+        // finish all queued jobs before shutting down
+        if (m_stopping && m_queued == 0) { return; }
+    }
+}
+
+bool ThreadPool::tryTake(const u32 index, Job& job)
+{
+    const u32 queueCount = static_cast<u32>(m_queues.size());
+    for (u32 i = 0; i < queueCount; i++) {
+        JobQueue& queue = *m_queues[(index + i) % queueCount];
+        std::lock_guard lock{ queue.mutex };
+        if (queue.jobs.empty()) { continue; }
+
+        // the owner works depth first on its most recent jobs, thieves take the oldest ones
+        if (i == 0) {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+        } else {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+        }
+        m_queued--;
+        return true;
+    }
+    return false;
+}
+
+Maybe<u32> ThreadPool::getWorkerIndex() const
+{
+    if (t_pool == this) { return t_workerIndex; }
+    return Nothing;
+}
+} // namespace siren::core
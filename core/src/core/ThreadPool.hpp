@@ -0,0 +1,85 @@
+/**
+ * @file ThreadPool.hpp
+ */
+#pragma once
+
+#include "utilities/spch.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+
+namespace siren::core
+{
+/**
+ * @brief A fixed set of worker threads executing submitted jobs, balanced via work stealing.
+ *
+ * Each worker owns a job queue. Jobs submitted from a worker go to its own queue and are taken
+ * from the back (most recently submitted first), idle workers steal from the front of other
+ * queues. Threads waiting for jobs in @ref parallelFor() help executing jobs, so it may safely be
+ * called from within a job.
+ *
+ * The engine wide pool is created on first use via ThreadPool::Get(). Jobs must not throw.
+ */
+class ThreadPool
+{
+public:
+    using Job = std::function<void()>;
+
+    /// @brief Creates a pool with workerCount threads. A count of 0 is allowed, in which case
+    /// submitted jobs are executed immediately on the submitting thread.
+    explicit ThreadPool(u32 workerCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// @brief Returns the engine wide pool. Uses one worker less than the hardware supports, so
+    /// the main thread always has a core to itself.
+    static ThreadPool& Get();
+
+    /// @brief Queues job for execution on one of the workers.
+    void submit(Job job);
+
+    /**
+     * @brief Splits the range [0, count) into pieces of at most grain elements and calls
+     * fn(begin, end) for each piece, concurrently on the workers and the calling thread. Returns
+     * once all pieces have been processed.
+     */
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn);
+
+    /// @brief Checks if the calling thread is one of the workers of this pool.
+    bool isWorkerThread() const { return getWorkerIndex().has_value(); }
+
+    /// @brief Returns the amount of worker threads of this pool.
+    u32 getWorkerCount() const { return static_cast<u32>(m_workers.size()); }
+
+private:
+    /// @brief The job queue owned by a single worker.
+    struct JobQueue
+    {
+        std::deque<Job> jobs{ };
+        std::mutex mutex{ };
+    };
+
+    Vector<std::thread> m_workers{ };
+    Vector<Own<JobQueue>> m_queues{ };
+    /// @brief The amount of queued jobs over all queues, used to let idle workers sleep.
+    std::atomic<size_t> m_queued{ 0 };
+    /// @brief Round-robin counter for jobs submitted from outside of the pool.
+    std::atomic<u32> m_nextQueue{ 0 };
+    std::mutex m_sleepMutex{ };
+    std::condition_variable m_condition{ };
+    bool m_stopping = false;
+
+    /// @brief The loop each worker runs until the pool is destroyed.
+    void workerLoop(u32 index);
+    /// @brief Takes a job, preferring the queue at index and stealing from others otherwise.
+    bool tryTake(u32 index, Job& job);
+    /// @brief Returns the queue index of the calling thread if it is a worker of this pool.
+    Maybe<u32> getWorkerIndex() const;
+};
+} // namespace siren::core
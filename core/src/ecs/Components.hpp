@@ -1,11 +1,13 @@
 #pragma once
 
 // misc components
-#include "components/HierarchyComponent.hpp"
+#include "components/BoundsComponent.hpp"
+#include "components/IDComponent.hpp"
 #include "components/MeshComponent.hpp"
 #include "components/ScriptContainerComponent.hpp"
 #include "components/TagComponent.hpp"
 #include "components/TransformComponent.hpp"
+#include "components/WorldTransformComponent.hpp"
 
 // camera components
 #include "components/BaseCameraComponent.hpp"
@@ -3,6 +3,8 @@
 // core systems
 #include "systems/RenderSystem.hpp"
 #include "systems/ScriptSystem.hpp"
+#include "systems/SpatialIndexSystem.hpp"
+#include "systems/TransformSystem.hpp"
 // #include "systems/PhysicsSystem.hpp"
 // #include "systems/CollisionSystem.hpp"
 // #include "systems/AnimationSystem.hpp"
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "ecs/core/Component.hpp"
+#include "utilities/spch.hpp"
 
 
 namespace siren::core
@@ -9,7 +9,7 @@ namespace siren::core
  * @brief A base class that all new CameraComponents should derive from. Doing so makes it usable by
  * the RenderSystem.
  */
-struct BaseCameraComponent : Component
+struct BaseCameraComponent
 {
     BaseCameraComponent(const int w, const int h) : viewportWidth(w), viewportHeight(h) { }
 
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "geometry/Bounds.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief The local space bounds of an entity. Together with a WorldTransformComponent this makes
+ * the entity part of the scene's @ref SpatialIndex, see @ref SpatialIndexSystem.
+ */
+struct BoundsComponent final
+{
+    AABB bounds;
+
+    BoundsComponent() = default;
+    explicit BoundsComponent(const AABB& bounds) : bounds(bounds) { }
+};
+} // namespace siren::core
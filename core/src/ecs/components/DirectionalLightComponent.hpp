@@ -1,12 +1,12 @@
 #pragma once
 
-#include "ecs/core/Component.hpp"
+#include "utilities/spch.hpp"
 
 
 namespace siren::core
 {
 
-struct DirectionalLightComponent final : Component
+struct DirectionalLightComponent final
 {
     glm::vec3 direction;
     glm::vec3 color;
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "utilities/UUID.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief The persistent identity of an entity. Every entity receives one on creation. Unlike the
+ * @ref EntityHandle, the UUID is never reused and stays the same across sessions, so it should be
+ * used whenever an entity needs to be referenced outside of the running scene.
+ */
+struct IDComponent final
+{
+    utilities::UUID id;
+
+    explicit IDComponent(const utilities::UUID& id) : id(id) { };
+};
+} // namespace siren::core
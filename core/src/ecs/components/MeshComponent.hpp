@@ -1,12 +1,12 @@
 #pragma once
 
 #include "assets/Asset.hpp"
-#include "ecs/core/Component.hpp"
+#include "utilities/spch.hpp"
 
 
 namespace siren::core
 {
-struct MeshComponent final : Component
+struct MeshComponent final
 {
     AssetHandle meshHandle = AssetHandle::invalid();
 
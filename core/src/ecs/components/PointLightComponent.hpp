@@ -1,11 +1,11 @@
 #pragma once
 
-#include "ecs/core/Component.hpp"
+#include "utilities/spch.hpp"
 
 
 namespace siren::core
 {
-struct PointLightComponent final : Component
+struct PointLightComponent final
 {
     glm::vec3 color{ 1 };
 
@@ -1,8 +1,7 @@
 #pragma once
 
-#include "ecs/components/BaseCameraComponent.hpp"
-#include "ecs/components/SkyLightComponent.hpp"
-#include "ecs/core/Component.hpp"
+#include "ecs/core/EntityHandle.hpp"
+#include "utilities/spch.hpp"
 
 
 namespace siren::core
@@ -10,17 +9,22 @@ namespace siren::core
 
 /**
  * @brief A component holding all relevant information needed for the RenderSystem.
+ *
+ * Refers to entities by handle and not by pointers to their components, as components move in
+ * memory whenever their entity gains or loses a component, and scene snapshots copy singletons as
+ * they are.
  */
-struct RenderContextComponent final : Component
+struct RenderContextComponent final
 {
-    // HACK: maybe don't use a raw pointer here??? maybe use an ActiveCameraTagComponent or something
-    BaseCameraComponent* cameraComponent = nullptr;
-    SkyLightComponent* skyBoxComponent   = nullptr;
+    /// @brief The entity whose camera component is rendered from.
+    EntityHandle camera = EntityHandle::invalid();
+    /// @brief The entity holding the SkyLightComponent.
+    EntityHandle skyBox = EntityHandle::invalid();
 
     explicit RenderContextComponent(
-        BaseCameraComponent* camera        = nullptr,
-        SkyLightComponent* skyBoxComponent = nullptr
-    ) : cameraComponent(camera), skyBoxComponent(skyBoxComponent) { }
+        const EntityHandle camera = EntityHandle::invalid(),
+        const EntityHandle skyBox = EntityHandle::invalid()
+    ) : camera(camera), skyBox(skyBox) { }
 };
 
 } // namespace siren::ecs
@@ -1,15 +1,24 @@
 #pragma once
 
-#include "ecs/core/Component.hpp"
 #include "script/NativeScript.hpp"
+#include "utilities/spch.hpp"
 
 
 namespace siren::core
 {
 
-struct ScriptContainerComponent final : Component
+struct ScriptContainerComponent final
 {
     Vector<Own<NativeScript>> scripts{ };
+
+    ScriptContainerComponent() = default;
+
+    // a vector claims to be copy constructible even when its elements are not, so the copy is
+    // deleted explicitly for the ECS to see that scripts cannot be copied
+    ScriptContainerComponent(const ScriptContainerComponent&)            = delete;
+    ScriptContainerComponent& operator=(const ScriptContainerComponent&) = delete;
+    ScriptContainerComponent(ScriptContainerComponent&&)                 = default;
+    ScriptContainerComponent& operator=(ScriptContainerComponent&&)      = default;
 };
 
 } // namespace siren::ecs
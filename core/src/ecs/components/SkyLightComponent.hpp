@@ -1,11 +1,11 @@
 #pragma once
 
-#include "ecs/core/Component.hpp"
+#include "utilities/spch.hpp"
 
 
 namespace siren::core
 {
-struct SkyLightComponent final : Component
+struct SkyLightComponent final
 {
     AssetHandle cubeMapHandle = AssetHandle::invalid();
 
@@ -1,10 +1,10 @@
 #pragma once
 
-#include "ecs/core/Component.hpp"
+#include "utilities/spch.hpp"
 
 namespace siren::core
 {
-struct SpotLightComponent final : Component
+struct SpotLightComponent final
 {
     glm::vec3 position;
     glm::vec3 color;
@@ -1,11 +1,11 @@
 #pragma once
 
-#include "ecs/core/Component.hpp"
+#include "utilities/spch.hpp"
 
 
 namespace siren::core
 {
-struct TagComponent final : Component
+struct TagComponent final
 {
     std::string tag;
 
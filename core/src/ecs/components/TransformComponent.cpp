@@ -0,0 +1,142 @@
+#include "TransformComponent.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define SIREN_TRANSFORM_SSE
+#include <xmmintrin.h>
+#endif
+
+
+namespace siren::core
+{
+glm::quat TransformComponent::FromEulerAngles(const glm::vec3& eulerAngles)
+{
+    // the order of the matrix this used to be stored as, glm::quat{ eulerAngles } composes them
+    // the other way around
+    return glm::angleAxis(eulerAngles.x, glm::vec3{ 1, 0, 0 }) *
+           glm::angleAxis(eulerAngles.y, glm::vec3{ 0, 1, 0 }) *
+           glm::angleAxis(eulerAngles.z, glm::vec3{ 0, 0, 1 });
+}
+
+glm::vec3 TransformComponent::ToEulerAngles(const glm::quat& rotation)
+{
+    // glm matrices are indexed [column][row]. The first row of rotate(x) * rotate(y) * rotate(z)
+    // is (cos y cos z, -cos y sin z, sin y), its last column (sin y, -sin x cos y, cos x cos y)
+    const glm::mat3 m = glm::mat3_cast(rotation);
+    const float cosY  = std::sqrt(m[0][0] * m[0][0] + m[1][0] * m[1][0]);
+    const float y     = std::atan2(m[2][0], cosY);
+
+    // gimbal lock, x and z rotate about the same axis, so all of it is attributed to x. Checked
+    // with some margin, close to it the other angles would mostly be made up of rounding errors
+    if (cosY < 3e-4f) { return { std::atan2(m[1][2], m[1][1]), y, 0.f }; }
+    return { std::atan2(-m[2][1], m[2][2]), y, std::atan2(-m[1][0], m[0][0]) };
+}
+
+glm::mat4 TransformComponent::Compose(
+    const glm::vec3& translation,
+    const glm::quat& rotation,
+    const glm::vec3& scale
+)
+{
+    // the same arithmetic as the SIMD path of UpdateTransforms(), so both yield identical results
+    const float x2 = rotation.x + rotation.x;
+    const float y2 = rotation.y + rotation.y;
+    const float z2 = rotation.z + rotation.z;
+
+    const float xx = rotation.x * x2;
+    const float yy = rotation.y * y2;
+    const float zz = rotation.z * z2;
+    const float xy = rotation.x * y2;
+    const float xz = rotation.x * z2;
+    const float yz = rotation.y * z2;
+    const float wx = rotation.w * x2;
+    const float wy = rotation.w * y2;
+    const float wz = rotation.w * z2;
+
+    return glm::mat4{
+        glm::vec4{ (1.f - (yy + zz)) * scale.x, (xy + wz) * scale.x, (xz - wy) * scale.x, 0.f },
+        glm::vec4{ (xy - wz) * scale.y, (1.f - (xx + zz)) * scale.y, (yz + wx) * scale.y, 0.f },
+        glm::vec4{ (xz + wy) * scale.z, (yz - wx) * scale.z, (1.f - (xx + yy)) * scale.z, 0.f },
+        glm::vec4{ translation, 1.f },
+    };
+}
+
+void TransformComponent::UpdateTransforms(const std::span<TransformComponent* const> transforms)
+{
+    size_t i = 0;
+
+#ifdef SIREN_TRANSFORM_SSE
+    // each register holds one scalar of four transforms, the resulting matrix elements are
+    // transposed back into the columns of each transform
+    for (; i + 4 <= transforms.size(); i += 4) {
+        TransformComponent* const* t = transforms.data() + i;
+
+        const auto gather = [t] (auto&& field) {
+            return _mm_setr_ps(field(*t[0]), field(*t[1]), field(*t[2]), field(*t[3]));
+        };
+        const __m128 qx = gather([] (const TransformComponent& c) { return c.m_rotation.x; });
+        const __m128 qy = gather([] (const TransformComponent& c) { return c.m_rotation.y; });
+        const __m128 qz = gather([] (const TransformComponent& c) { return c.m_rotation.z; });
+        const __m128 qw = gather([] (const TransformComponent& c) { return c.m_rotation.w; });
+        const __m128 sx = gather([] (const TransformComponent& c) { return c.m_scale.x; });
+        const __m128 sy = gather([] (const TransformComponent& c) { return c.m_scale.y; });
+        const __m128 sz = gather([] (const TransformComponent& c) { return c.m_scale.z; });
+        __m128 tx       = gather([] (const TransformComponent& c) { return c.m_translation.x; });
+        __m128 ty       = gather([] (const TransformComponent& c) { return c.m_translation.y; });
+        __m128 tz       = gather([] (const TransformComponent& c) { return c.m_translation.z; });
+
+        const __m128 one = _mm_set1_ps(1.f);
+        const __m128 x2  = _mm_add_ps(qx, qx);
+        const __m128 y2  = _mm_add_ps(qy, qy);
+        const __m128 z2  = _mm_add_ps(qz, qz);
+
+        const __m128 xx = _mm_mul_ps(qx, x2);
+        const __m128 yy = _mm_mul_ps(qy, y2);
+        const __m128 zz = _mm_mul_ps(qz, z2);
+        const __m128 xy = _mm_mul_ps(qx, y2);
+        const __m128 xz = _mm_mul_ps(qx, z2);
+        const __m128 yz = _mm_mul_ps(qy, z2);
+        const __m128 wx = _mm_mul_ps(qw, x2);
+        const __m128 wy = _mm_mul_ps(qw, y2);
+        const __m128 wz = _mm_mul_ps(qw, z2);
+
+        __m128 c0x = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(yy, zz)), sx);
+        __m128 c0y = _mm_mul_ps(_mm_add_ps(xy, wz), sx);
+        __m128 c0z = _mm_mul_ps(_mm_sub_ps(xz, wy), sx);
+        __m128 c0w = _mm_setzero_ps();
+        __m128 c1x = _mm_mul_ps(_mm_sub_ps(xy, wz), sy);
+        __m128 c1y = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, zz)), sy);
+        __m128 c1z = _mm_mul_ps(_mm_add_ps(yz, wx), sy);
+        __m128 c1w = _mm_setzero_ps();
+        __m128 c2x = _mm_mul_ps(_mm_add_ps(xz, wy), sz);
+        __m128 c2y = _mm_mul_ps(_mm_sub_ps(yz, wx), sz);
+        __m128 c2z = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, yy)), sz);
+        __m128 c2w = _mm_setzero_ps();
+        __m128 tw  = one;
+
+        _MM_TRANSPOSE4_PS(c0x, c0y, c0z, c0w);
+        _MM_TRANSPOSE4_PS(c1x, c1y, c1z, c1w);
+        _MM_TRANSPOSE4_PS(c2x, c2y, c2z, c2w);
+        _MM_TRANSPOSE4_PS(tx, ty, tz, tw);
+
+        const __m128 columns[4][4] = {
+            { c0x, c1x, c2x, tx },
+            { c0y, c1y, c2y, ty },
+            { c0z, c1z, c2z, tz },
+            { c0w, c1w, c2w, tw },
+        };
+        for (u32 lane = 0; lane < 4; lane++) {
+            glm::mat4& matrix = t[lane]->m_matrix;
+            for (u32 column = 0; column < 4; column++) {
+                _mm_storeu_ps(&matrix[column][0], columns[lane][column]);
+            }
+            t[lane]->m_dirty = false;
+        }
+    }
+#endif
+
+    for (; i < transforms.size(); i++) {
+        transforms[i]->m_dirty = true;
+        transforms[i]->UpdateTransform();
+    }
+}
+} // namespace siren::core
@@ -1,32 +1,114 @@
 #pragma once
 
-#include "ecs/core/Component.hpp"
+#include "utilities/spch.hpp"
 #include <glm/gtc/quaternion.hpp>
 
+#include <span>
+
 
 namespace siren::core
 {
-// todo: no quaternion here please
-
-struct TransformComponent final : Component
+/**
+ * @brief The local translation, rotation and scale of an entity. The composed matrix is cached and
+ * only recomputed after one of the parts has been changed through a setter, either lazily via
+ * UpdateTransform() or for many transforms at once via UpdateTransforms().
+ */
+struct TransformComponent final
 {
     TransformComponent() = default;
-    TransformComponent(const glm::vec3& t, const glm::vec3& r, const glm::vec3 s) : translation(t), rotation(r),
-        scale(s) { }
+    TransformComponent(
+        const glm::vec3& translation,
+        const glm::quat& rotation,
+        const glm::vec3& scale
+    ) : m_translation(translation), m_rotation(rotation), m_scale(scale) { }
+    /// @brief Creates a transform from euler angles in radians, see SetEulerAngles().
+    TransformComponent(
+        const glm::vec3& translation,
+        const glm::vec3& eulerAngles,
+        const glm::vec3& scale
+    ) : m_translation(translation), m_rotation(FromEulerAngles(eulerAngles)), m_scale(scale) { }
+
+    const glm::vec3& GetTranslation() const { return m_translation; }
+
+    void SetTranslation(const glm::vec3& translation)
+    {
+        m_translation = translation;
+        m_dirty       = true;
+    }
+
+    void Translate(const glm::vec3& offset) { SetTranslation(m_translation + offset); }
+
+    const glm::quat& GetRotation() const { return m_rotation; }
+
+    void SetRotation(const glm::quat& rotation)
+    {
+        m_rotation = rotation;
+        m_dirty    = true;
+    }
+
+    /// @brief Applies rotation on top of the current rotation.
+    void Rotate(const glm::quat& rotation) { SetRotation(glm::normalize(rotation * m_rotation)); }
+
+    /// @brief Returns the rotation as euler angles in radians, see FromEulerAngles().
+    glm::vec3 GetEulerAngles() const { return ToEulerAngles(m_rotation); }
 
-    glm::vec3 translation{ 0.f };
-    glm::vec3 rotation{ 0.f };
-    glm::vec3 scale{ 1.f };
+    /// @brief Sets the rotation from euler angles in radians, see FromEulerAngles().
+    void SetEulerAngles(const glm::vec3& eulerAngles) { SetRotation(FromEulerAngles(eulerAngles)); }
 
+    const glm::vec3& GetScale() const { return m_scale; }
+
+    void SetScale(const glm::vec3& scale)
+    {
+        m_scale = scale;
+        m_dirty = true;
+    }
+
+    /// @brief Checks if the cached matrix is out of date.
+    bool IsDirty() const { return m_dirty; }
+
+    /// @brief Returns the local matrix, i.e. translation * rotation * scale. Uses the cached matrix
+    /// if it is up to date, otherwise composes the matrix without caching it, so this is safe to
+    /// call concurrently.
     glm::mat4 GetTransform() const
     {
-        const glm::mat4 rotMat =
-                glm::rotate(glm::mat4(1.0f), rotation.x, glm::vec3(1, 0, 0)) *
-                glm::rotate(glm::mat4(1.0f), rotation.y, glm::vec3(0, 1, 0)) *
-                glm::rotate(glm::mat4(1.0f), rotation.z, glm::vec3(0, 0, 1));
+        return m_dirty ? Compose(m_translation, m_rotation, m_scale) : m_matrix;
+    }
 
-        return glm::translate(glm::mat4(1.0f), translation) * rotMat *
-                glm::scale(glm::mat4(1.0f), scale);
+    /// @brief Recomputes the cached matrix if it is out of date and returns it.
+    const glm::mat4& UpdateTransform()
+    {
+        if (m_dirty) {
+            m_matrix = Compose(m_translation, m_rotation, m_scale);
+            m_dirty  = false;
+        }
+        return m_matrix;
     }
+
+    /// @brief Recomputes the cached matrices of all given transforms. Transforms are processed in
+    /// groups of four SIMD lanes where supported, which is considerably cheaper than calling
+    /// UpdateTransform() on each.
+    static void UpdateTransforms(std::span<TransformComponent* const> transforms);
+
+    /// @brief Returns the rotation about the x, then the y and then the z axis of the rotated
+    /// frame, i.e. rotate(x) * rotate(y) * rotate(z), with the angles in radians.
+    static glm::quat FromEulerAngles(const glm::vec3& eulerAngles);
+
+    /// @brief The inverse of FromEulerAngles(). The y angle lies within [-pi/2, pi/2], when it
+    /// reaches either end the z angle is 0.
+    static glm::vec3 ToEulerAngles(const glm::quat& rotation);
+
+    /// @brief Composes translation * rotation * scale into a matrix.
+    static glm::mat4 Compose(
+        const glm::vec3& translation,
+        const glm::quat& rotation,
+        const glm::vec3& scale
+    );
+
+private:
+    glm::vec3 m_translation{ 0.f };
+    glm::quat m_rotation{ 1.f, 0.f, 0.f, 0.f };
+    glm::vec3 m_scale{ 1.f };
+    bool m_dirty = true;
+    glm::mat4 m_matrix{ 1.f };
 };
-} // namespace siren::ecs
+} // namespace siren::core
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief The final model matrix of an entity, i.e. its local TransformComponent composed with
+ * the world transforms of all its ancestors. Maintained by the @ref TransformSystem, which adds
+ * it to every entity with a TransformComponent, and should be treated as read only by anyone
+ * else.
+ *
+ * Holds nothing but the matrix, so a column of these is a tightly packed array of mat4's that can
+ * be read or uploaded as is.
+ */
+struct WorldTransformComponent final
+{
+    glm::mat4 matrix{ 1.f };
+
+    WorldTransformComponent() = default;
+    explicit WorldTransformComponent(const glm::mat4& matrix) : matrix(matrix) { }
+};
+} // namespace siren::core
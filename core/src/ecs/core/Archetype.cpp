@@ -0,0 +1,86 @@
+#include "Archetype.hpp"
+
+
+namespace siren::core
+{
+Archetype::Archetype(const ComponentMask mask, const TypeInfos& infos) : m_mask(mask)
+{
+    m_columnIndex.fill(-1);
+    for (size_t i = 0; i < MAX_COMPONENTS; i++) {
+        if (!m_mask.test(i)) { continue; }
+        SirenAssert(infos[i], "Cannot create an Archetype with an unregistered component type");
+        m_columnIndex[i] = static_cast<i32>(m_columns.size());
+        m_columns.push_back(CreateOwn<ComponentColumn>(infos[i]));
+    }
+}
+
+void Archetype::reserve(const size_t capacity)
+{
+    m_entities.reserve(capacity);
+    for (const auto& column : m_columns) { column->reserve(capacity); }
+}
+
+size_t Archetype::appendRow(const EntityHandle entity)
+{
+    m_entities.push_back(entity);
+    for (const auto& column : m_columns) { column->pushUninitialized(); }
+    return m_entities.size() - 1;
+}
+
+EntityHandle Archetype::removeRow(const size_t row)
+{
+    for (const auto& column : m_columns) { column->erase(row); }
+    return popEntity(row);
+}
+
+size_t Archetype::moveRow(const size_t row, Archetype& target, EntityHandle& swapped)
+{
+    const size_t targetRow = target.appendRow(m_entities[row]);
+
+    for (const auto& column : m_columns) {
+        const size_t bitIndex = column->getTypeInfo()->bitIndex;
+        if (ComponentColumn* targetColumn = target.getColumn(bitIndex)) {
+            column->moveTo(row, *targetColumn, targetRow);
+        } else {
+            column->erase(row);
+        }
+    }
+
+    swapped = popEntity(row);
+    return targetRow;
+}
+
+void Archetype::clear()
+{
+    m_entities.clear();
+    for (const auto& column : m_columns) { column->clear(); }
+}
+
+void Archetype::append(const Archetype& source)
+{
+    SirenAssert((source.m_mask & m_mask) == m_mask, "Cannot append rows missing components");
+
+    m_entities.insert(m_entities.end(), source.m_entities.begin(), source.m_entities.end());
+    for (const auto& column : m_columns) {
+        column->append(*source.getColumn(column->getTypeInfo()->bitIndex));
+    }
+}
+
+void Archetype::markAllAdded(const u32 tick)
+{
+    for (const auto& column : m_columns) { column->markAllAdded(tick); }
+}
+
+EntityHandle Archetype::popEntity(const size_t row)
+{
+    const size_t last = m_entities.size() - 1;
+    if (row == last) {
+        m_entities.pop_back();
+        return EntityHandle::invalid();
+    }
+
+    m_entities[row] = m_entities[last];
+    m_entities.pop_back();
+    return m_entities[row];
+}
+} // namespace siren::core
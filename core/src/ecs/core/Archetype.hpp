@@ -0,0 +1,99 @@
+#pragma once
+
+#include "ComponentColumn.hpp"
+#include "EntityManager.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief An Archetype stores all entities that have exactly the same @ref
+ * EntityManager::ComponentMask. Each component type of the mask is stored in its own contiguous
+ * @ref ComponentColumn, and the components of a single entity all live in the same row.
+ */
+class Archetype
+{
+public:
+    using ComponentMask = EntityManager::ComponentMask;
+    using TypeInfos     = Array<const ComponentTypeInfo*, MAX_COMPONENTS>;
+
+    /// @brief Creates an empty archetype. Every bit set in mask must have an entry in infos.
+    Archetype(ComponentMask mask, const TypeInfos& infos);
+
+    Archetype(Archetype&)            = delete;
+    Archetype& operator=(Archetype&) = delete;
+
+    /// @brief Returns the mask all entities of this archetype share.
+    ComponentMask getMask() const { return m_mask; }
+
+    /// @brief Returns the amount of entities (rows) stored.
+    size_t size() const { return m_entities.size(); }
+
+    /// @brief Returns the entity of each row.
+    const Vector<EntityHandle>& getEntities() const { return m_entities; }
+
+    /// @brief Checks if this archetype stores the component with the given bit index.
+    bool has(const size_t bitIndex) const { return m_mask.test(bitIndex); }
+
+    /// @brief Returns the column of the given component bit index, or nullptr if not present.
+    ComponentColumn* getColumn(const size_t bitIndex) const
+    {
+        const i32 column = m_columnIndex[bitIndex];
+        return column < 0 ? nullptr : m_columns[column].get();
+    }
+
+    /// @brief Makes sure all columns can hold at least capacity rows without reallocating.
+    void reserve(size_t capacity);
+
+    /// @brief Appends a new row for entity and returns its index. All column slots of the row are
+    /// left uninitialized and must be constructed by the caller.
+    size_t appendRow(EntityHandle entity);
+
+    /// @brief Destroys all components at row. The last row is moved into row to keep the storage
+    /// dense, its entity is returned so that the caller can update its location. Returns an
+    /// invalid handle if no entity was moved.
+    EntityHandle removeRow(size_t row);
+
+    /// @brief Moves the entity at row into target. Components that target does not store are
+    /// destroyed, components that only target stores are left uninitialized. Returns the new row in
+    /// target and writes the entity that was moved into row (or an invalid handle) into swapped.
+    size_t moveRow(size_t row, Archetype& target, EntityHandle& swapped);
+
+    /// @brief Destroys all rows, the storage is kept.
+    void clear();
+
+    /// @brief Appends copies of all rows of source, whose mask must contain this archetype's mask.
+    /// Components that only source stores are skipped.
+    void append(const Archetype& source);
+
+    /// @brief Marks all components as added at tick.
+    void markAllAdded(u32 tick);
+
+    /// @brief Returns the cached archetype reached by adding the component bit, or nullptr.
+    Archetype* getAddEdge(const size_t bitIndex) const { return m_addEdges[bitIndex]; }
+    /// @brief Returns the cached archetype reached by removing the component bit, or nullptr.
+    Archetype* getRemoveEdge(const size_t bitIndex) const { return m_removeEdges[bitIndex]; }
+    /// @brief Caches the archetype reached by adding the component bit.
+    void setAddEdge(const size_t bitIndex, Archetype* archetype) { m_addEdges[bitIndex] = archetype; }
+    /// @brief Caches the archetype reached by removing the component bit.
+    void setRemoveEdge(const size_t bitIndex, Archetype* archetype) { m_removeEdges[bitIndex] = archetype; }
+
+private:
+    ComponentMask m_mask;
+    /// @brief The entity stored in each row.
+    Vector<EntityHandle> m_entities{ };
+    /// @brief The component columns, ordered by bit index.
+    Vector<Own<ComponentColumn>> m_columns{ };
+    /// @brief Maps a component bit index to its index into m_columns, -1 if not part of the mask.
+    Array<i32, MAX_COMPONENTS> m_columnIndex{ };
+
+    /// @brief Graph edges to neighbouring archetypes, avoids hashing masks on every transition.
+    Array<Archetype*, MAX_COMPONENTS> m_addEdges{ };
+    Array<Archetype*, MAX_COMPONENTS> m_removeEdges{ };
+
+    /// @brief Swap removes the entity at row, returns the entity moved into row or an invalid
+    /// handle.
+    EntityHandle popEntity(size_t row);
+};
+} // namespace siren::core
@@ -0,0 +1,197 @@
+#include "CommandBuffer.hpp"
+
+#include "Scene.hpp"
+#include "ecs/components/IDComponent.hpp"
+
+
+namespace siren::core
+{
+CommandBuffer::CommandBuffer(Scene& scene) : m_scene(&scene) { }
+
+CommandBuffer::~CommandBuffer()
+{
+    reset();
+    for (byte* block : m_blocks) { ::operator delete(block, std::align_val_t{ CACHE_LINE_SIZE }); }
+}
+
+EntityHandle CommandBuffer::create()
+{
+    const EntityHandle entity = m_scene->m_entityManager.reserve();
+    m_commands.push_back({ CommandType::Create, entity, nullptr, nullptr });
+    emplace<IDComponent>(entity, utilities::UUID::create());
+    return entity;
+}
+
+void CommandBuffer::emplace(
+    const EntityHandle entity,
+    const ComponentManager::PrototypeComponent& prototype
+)
+{
+    const ComponentTypeInfo* info = prototype.info;
+    void* component               = allocate(info->size, info->alignment);
+    info->copy(component, prototype.component);
+    m_commands.push_back({ CommandType::Emplace, entity, info, component });
+}
+
+void CommandBuffer::destroy(const EntityHandle entity)
+{
+    m_commands.push_back({ CommandType::Destroy, entity, nullptr, nullptr });
+}
+
+void CommandBuffer::flush()
+{
+    if (m_commands.empty()) { return; }
+
+    EntityManager& entityManager       = m_scene->m_entityManager;
+    ComponentManager& componentManager = m_scene->m_componentManager;
+
+    m_pending.clear();
+    m_pendingIndex.clear();
+    m_staged.clear();
+    m_destroyed.clear();
+
+    // merge all commands per entity, staged components made obsolete by later commands are
+    // discarded right away
+    for (size_t i = 0; i < m_commands.size(); i++) {
+        Command& command = m_commands[i];
+
+        const auto [it, inserted] = m_pendingIndex.try_emplace(
+            command.entity,
+            static_cast<u32>(m_pending.size())
+        );
+        if (inserted) { m_pending.push_back({ command.entity }); }
+        command.pending = it->second;
+
+        PendingEntity& pending = m_pending[command.pending];
+
+        switch (command.type) {
+            case CommandType::Create: {
+                pending.created = true;
+                break;
+            }
+            case CommandType::Destroy: {
+                pending.destroyed = true;
+                break;
+            }
+            case CommandType::Emplace: {
+                const size_t bitIndex = command.info->bitIndex;
+                if (pending.destroyed || pending.staged.test(bitIndex)) {
+                    discard(command);
+                } else {
+                    pending.staged.set(bitIndex);
+                }
+                break;
+            }
+            case CommandType::Remove: {
+                const size_t bitIndex = command.info->bitIndex;
+                if (pending.staged.test(bitIndex)) {
+                    for (size_t j = i; j-- > 0;) {
+                        Command& previous = m_commands[j];
+                        if (previous.type == CommandType::Emplace && previous.component &&
+                            previous.pending == command.pending &&
+                            previous.info->bitIndex == bitIndex) {
+                            discard(previous);
+                            break;
+                        }
+                    }
+                    pending.staged.reset(bitIndex);
+                }
+                pending.removed.set(bitIndex);
+                break;
+            }
+        }
+    }
+
+    // group the remaining staged components by entity
+    for (const auto& command : m_commands) {
+        if (command.component) { m_pending[command.pending].stagedCount++; }
+    }
+    u32 offset = 0;
+    for (auto& pending : m_pending) {
+        pending.stagedBegin = offset;
+        offset += pending.stagedCount;
+        pending.stagedCount = 0;
+    }
+    m_staged.resize(offset);
+    for (const auto& command : m_commands) {
+        if (!command.component) { continue; }
+        PendingEntity& pending                                = m_pending[command.pending];
+        m_staged[pending.stagedBegin + pending.stagedCount++] = { command.info, command.component };
+    }
+
+    // apply, each entity moves archetypes at most once
+    for (const auto& pending : m_pending) {
+        const std::span staged{ m_staged.data() + pending.stagedBegin, pending.stagedCount };
+
+        if (pending.created) { entityManager.activate(pending.entity); }
+
+        if (pending.destroyed || !entityManager.isAlive(pending.entity)) {
+            for (const auto& [info, component] : staged) { info->destroy(component); }
+            if (entityManager.isAlive(pending.entity)) {
+                entityManager.destroy(pending.entity);
+                componentManager.destroy(pending.entity);
+                m_destroyed.push_back(pending.entity);
+            }
+            continue;
+        }
+
+        componentManager.apply(pending.entity, pending.removed, staged);
+        if (pending.removed.any()) { m_scene->onComponentsRemoved(pending.entity); }
+    }
+
+    m_scene->m_hierarchy.remove(m_destroyed, componentManager.getChangeTick());
+    for (const EntityHandle entity : m_destroyed) { m_scene->m_spatialIndex.remove(entity); }
+
+    trc("Flushed {} commands affecting {} entities", m_commands.size(), m_pending.size());
+
+    // all staged components have been consumed
+    m_commands.clear();
+    reset();
+}
+
+void* CommandBuffer::allocate(const size_t size, const size_t alignment)
+{
+    SirenAssert(alignment <= CACHE_LINE_SIZE, "Component alignment exceeds the staging alignment");
+
+    if (size > BLOCK_SIZE) {
+        m_largeBlocks.push_back(
+            static_cast<byte*>(::operator new(size, std::align_val_t{ CACHE_LINE_SIZE }))
+        );
+        return m_largeBlocks.back();
+    }
+
+    size_t offset = (m_offset + alignment - 1) & ~(alignment - 1);
+    if (m_blocks.empty() || offset + size > BLOCK_SIZE) {
+        if (!m_blocks.empty()) { m_block++; }
+        if (m_block == m_blocks.size()) {
+            m_blocks.push_back(
+                static_cast<byte*>(::operator new(BLOCK_SIZE, std::align_val_t{ CACHE_LINE_SIZE }))
+            );
+        }
+        offset = 0;
+    }
+
+    m_offset = offset + size;
+    return m_blocks[m_block] + offset;
+}
+
+void CommandBuffer::discard(Command& command)
+{
+    if (!command.component) { return; }
+    command.info->destroy(command.component);
+    command.component = nullptr;
+}
+
+void CommandBuffer::reset()
+{
+    for (auto& command : m_commands) { discard(command); }
+    m_commands.clear();
+
+    for (byte* block : m_largeBlocks) {
+        ::operator delete(block, std::align_val_t{ CACHE_LINE_SIZE });
+    }
+    m_largeBlocks.clear();
+    m_block  = 0;
+    m_offset = 0;
+}
+} // namespace siren::core
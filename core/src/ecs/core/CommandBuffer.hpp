@@ -0,0 +1,128 @@
+#pragma once
+
+#include "ComponentManager.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+class Scene;
+
+/**
+ * @brief Records structural changes to a @ref Scene, i.e. creating and destroying entities and
+ * adding and removing components, and applies them later in one batch.
+ *
+ * Recording never touches the scene's storage, so it is safe while the scene is being iterated.
+ * Each thread records into its own buffer, see Scene::Commands(). On flush, all changes to the same
+ * entity are merged, so an entity receiving several components moves archetypes only once.
+ *
+ * Components passed to emplace() are constructed immediately into staging memory owned by the
+ * buffer and relocated into the scene on flush.
+ */
+class CommandBuffer
+{
+public:
+    explicit CommandBuffer(Scene& scene);
+    ~CommandBuffer();
+
+    CommandBuffer(CommandBuffer&)            = delete;
+    CommandBuffer& operator=(CommandBuffer&) = delete;
+
+    /// @brief Reserves a new entity which becomes alive on flush. The handle may be used for
+    /// further commands right away.
+    EntityHandle create();
+
+    /// @brief Destroys entity on flush.
+    void destroy(EntityHandle entity);
+
+    /// @brief Adds a component of type T to entity on flush. The returned reference is only valid
+    /// until the flush. As with Scene::Emplace(), an existing component is never overwritten.
+    template <typename T, typename... Args>
+        requires(ComponentType<T>)
+    T& emplace(const EntityHandle entity, Args&&... args)
+    {
+        const ComponentTypeInfo* info = ComponentTypeInfo::get<T>();
+        T* component = new(allocate(info->size, info->alignment)) T(std::forward<Args>(args)...);
+        m_commands.push_back({ CommandType::Emplace, entity, info, component });
+        return *component;
+    }
+
+    /// @brief Adds a copy of the prototype to entity on flush.
+    void emplace(EntityHandle entity, const ComponentManager::PrototypeComponent& prototype);
+
+    /// @brief Removes the component of type T from entity on flush.
+    template <typename T>
+        requires(ComponentType<T>)
+    void remove(const EntityHandle entity)
+    {
+        m_commands.push_back({ CommandType::Remove, entity, ComponentTypeInfo::get<T>(), nullptr });
+    }
+
+    /// @brief Returns the amount of recorded commands.
+    size_t size() const { return m_commands.size(); }
+
+    /// @brief Checks if no commands are recorded.
+    bool empty() const { return m_commands.empty(); }
+
+    /// @brief Applies all recorded commands to the scene and clears the buffer. Must not be called
+    /// while the scene is being iterated or updated from other threads.
+    void flush();
+
+    /// @brief Discards all recorded commands without applying them, freeing their staged
+    /// components. Reserved entities stay reserved.
+    void reset();
+
+private:
+    enum class CommandType { Create, Destroy, Emplace, Remove };
+
+    struct Command
+    {
+        CommandType type;
+        EntityHandle entity;
+        const ComponentTypeInfo* info;
+        /// @brief The staged component of an emplace, nullptr once consumed or discarded.
+        void* component;
+        /// @brief Index into m_pending of the entity, assigned on flush.
+        u32 pending = 0;
+    };
+
+    /// @brief The merged changes of a single entity.
+    struct PendingEntity
+    {
+        EntityHandle entity;
+        /// @brief Components to remove before the staged components are added.
+        EntityManager::ComponentMask removed{ };
+        /// @brief Components with a live staged component.
+        EntityManager::ComponentMask staged{ };
+        bool created   = false;
+        bool destroyed = false;
+        /// @brief The range of this entity's staged components in m_staged.
+        u32 stagedBegin = 0;
+        u32 stagedCount = 0;
+    };
+
+    /// @brief The staging memory is handed out from blocks of this size.
+    static constexpr size_t BLOCK_SIZE = 16 * 1024;
+
+    Scene* m_scene;
+    Vector<Command> m_commands{ };
+
+    /// @brief Staging memory, kept across flushes.
+    Vector<byte*> m_blocks{ };
+    /// @brief Blocks for components not fitting into a regular block, freed on flush.
+    Vector<byte*> m_largeBlocks{ };
+    size_t m_block  = 0;
+    size_t m_offset = 0;
+
+    // scratch storage of flush(), kept to avoid reallocating each flush
+    Vector<PendingEntity> m_pending{ };
+    HashMap<EntityHandle, u32> m_pendingIndex{ };
+    Vector<ComponentManager::StagedComponent> m_staged{ };
+    Vector<EntityHandle> m_destroyed{ };
+
+    /// @brief Returns uninitialized staging memory for a single component.
+    void* allocate(size_t size, size_t alignment);
+    /// @brief Destroys the staged component of command, if it still holds one.
+    static void discard(Command& command);
+};
+} // namespace siren::core
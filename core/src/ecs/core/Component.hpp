@@ -6,32 +6,44 @@
 namespace siren::core
 {
 
-// todo: we dont actually need a base Component struct, we can use type erasure (which we do
-//  anyway using std::type_index), to allow any structs to become Components
-
-/// @brief Unique Handle for components. Is not randomly assigned, but sequentially. 0 is an invalid
-/// handle.
-using ComponentHandle                       = u32;
-constexpr ComponentHandle INVALID_COMPONENT = 0;
+/**
+ * @brief Any struct or class that can be moved and destroyed can be used as a component, there is
+ * no common base class. Components are stored type erased (see ComponentTypeInfo), so plain
+ * structs pack tightly and trivially copyable ones are relocated with memcpy.
+ */
+template <typename T>
+concept ComponentType = std::is_class_v<std::remove_cv_t<T>> &&
+                        std::is_move_constructible_v<std::remove_cv_t<T>> &&
+                        std::is_destructible_v<std::remove_cv_t<T>>;
 
-// ReSharper disable once CppClassCanBeFinal
 /**
- * @brief The base Component abstract class that all other Components must implement.
+ * @brief How the components of a type are stored. A component type selects its storage by
+ * declaring a static constexpr STORAGE member, types without one use ARCHETYPE.
  */
-struct Component
+enum class ComponentStorage
 {
-    Component();
-
-    ComponentHandle getComponentHandle() const;
-
-    virtual ~Component()                       = default;
-    Component(Component&)                      = delete; // no copying please
-    Component operator=(const Component&)      = delete;
-    Component(Component&&) noexcept            = default;
-    Component& operator=(Component&&) noexcept = default;
-
-private:
-    ComponentHandle handle;
+    /// @brief Stored in the columns of the entity's archetype. The fastest to iterate, but adding
+    /// or removing the component moves all of the entity's components to another archetype.
+    ARCHETYPE,
+    /// @brief Stored in a sparse set outside of the archetypes. Adding and removing is O(1) and
+    /// never moves the entity's other components, at the cost of a lookup per access. Meant for
+    /// components that are added and removed frequently.
+    SPARSE,
+    /// @brief A marker component without any data, i.e. an empty struct. Only a single bit per
+    /// entity is stored, all entities share the same instance of the type.
+    TAG,
 };
 
-} // namespace siren::ecs
+/// @brief Returns the storage selected by the component type T.
+template <typename T>
+constexpr ComponentStorage getComponentStorage()
+{
+    using Type = std::remove_cvref_t<T>;
+    if constexpr (requires { { Type::STORAGE } -> std::convertible_to<ComponentStorage>; }) {
+        return Type::STORAGE;
+    } else {
+        return ComponentStorage::ARCHETYPE;
+    }
+}
+
+} // namespace siren::core
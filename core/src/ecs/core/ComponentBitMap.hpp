@@ -1,37 +1,53 @@
 #pragma once
 
+#include "Component.hpp"
 #include "ECSProperties.hpp"
 #include "utilities/spch.hpp"
-#include <typeindex>
+
+#include <atomic>
 
 namespace siren::core
 {
 
-struct Component;
-
 /**
  * @brief This class handles assigning each Component Type a unique index in the range [0,
- * MAX_COMPONENTS]. This is used for setting the ComponentMask bits.
+ * MAX_COMPONENTS). This is used for setting the ComponentMask bits.
+ *
+ * Each type receives its index on first use, which is stored in a function local static. After
+ * that, resolving the index is a single initialization guard check with no lookups. Registration
+ * is thread-safe.
  */
 class ComponentBitMap
 {
 public:
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     static size_t getBitIndex()
     {
-        SirenAssert(s_nextIndex <= MAX_COMPONENTS,
-                    "Cannot register more components than MAX_COMPONENTS allows!");
+        // cv qualified types must share the index of the plain type
+        return bitIndexOf<std::remove_cvref_t<T>>();
+    }
 
-        const auto typeIndex = std::type_index(typeid(T));
-        if (!s_registry.contains(typeIndex)) { s_registry[typeIndex] = s_nextIndex++; }
+private:
+    static inline std::atomic<size_t> s_nextIndex{ 0 };
 
-        return s_registry[typeIndex];
+    template <typename T>
+    static size_t bitIndexOf()
+    {
+        static const size_t index = allocateIndex();
+        return index;
     }
 
-private:
-    static inline HashMap<std::type_index, size_t> s_registry{};
-    static inline size_t s_nextIndex = 0;
+    static size_t allocateIndex()
+    {
+        const size_t index = s_nextIndex.fetch_add(1, std::memory_order_relaxed);
+        SirenAssert(
+            index < MAX_COMPONENTS,
+            "Cannot register more components than MAX_COMPONENTS = {} allows!",
+            MAX_COMPONENTS
+        );
+        return index;
+    }
 };
 
 } // namespace siren::ecs
@@ -0,0 +1,104 @@
+#include "ComponentColumn.hpp"
+
+
+namespace siren::core
+{
+ComponentColumn::ComponentColumn(const ComponentTypeInfo* info) : m_info(info)
+{
+    SirenAssert(m_info, "Cannot create a ComponentColumn without type info");
+}
+
+ComponentColumn::~ComponentColumn()
+{
+    if (!m_info->trivial) {
+        for (size_t i = 0; i < m_size; i++) { m_info->destroy(at(i)); }
+    }
+    if (m_data) { ::operator delete(m_data, std::align_val_t{ getAllocationAlignment() }); }
+}
+
+void ComponentColumn::reserve(const size_t capacity)
+{
+    if (capacity <= m_capacity) { return; }
+
+    auto* data = static_cast<byte*>(
+        ::operator new(capacity * m_info->size, std::align_val_t{ getAllocationAlignment() })
+    );
+    if (m_info->trivial) {
+        if (m_size > 0) { std::memcpy(data, m_data, m_size * m_info->size); }
+    } else {
+        for (size_t i = 0; i < m_size; i++) { m_info->relocate(data + i * m_info->size, at(i)); }
+    }
+    if (m_data) { ::operator delete(m_data, std::align_val_t{ getAllocationAlignment() }); }
+
+    m_data     = data;
+    m_capacity = capacity;
+    m_addedTicks.reserve(capacity);
+    m_changedTicks.reserve(capacity);
+}
+
+void* ComponentColumn::pushUninitialized()
+{
+    if (m_size == m_capacity) { reserve(m_capacity == 0 ? 8 : m_capacity * 2); }
+    m_addedTicks.push_back(0);
+    m_changedTicks.push_back(0);
+    return at(m_size++);
+}
+
+void ComponentColumn::erase(const size_t row)
+{
+    if (!m_info->trivial) { m_info->destroy(at(row)); }
+    fillGap(row);
+}
+
+void ComponentColumn::moveTo(const size_t row, ComponentColumn& target, const size_t targetRow)
+{
+    relocate(target.at(targetRow), at(row));
+    target.m_addedTicks[targetRow]   = m_addedTicks[row];
+    target.m_changedTicks[targetRow] = m_changedTicks[row];
+    fillGap(row);
+}
+
+void ComponentColumn::clear()
+{
+    if (!m_info->trivial) {
+        for (size_t i = 0; i < m_size; i++) { m_info->destroy(at(i)); }
+    }
+    m_size = 0;
+    m_addedTicks.clear();
+    m_changedTicks.clear();
+}
+
+void ComponentColumn::append(const ComponentColumn& source)
+{
+    SirenAssert(m_info == source.m_info, "Cannot append a column of a different type");
+    SirenAssert(m_info->copy, "Cannot copy a column of a non copyable type");
+    if (source.m_size == 0) { return; }
+
+    reserve(m_size + source.m_size);
+    if (m_info->trivial) {
+        std::memcpy(at(m_size), source.m_data, source.m_size * m_info->size);
+    } else {
+        for (size_t i = 0; i < source.m_size; i++) { m_info->copy(at(m_size + i), source.at(i)); }
+    }
+    m_size += source.m_size;
+    m_addedTicks.insert(m_addedTicks.end(), source.m_addedTicks.begin(), source.m_addedTicks.end());
+    m_changedTicks.insert(
+        m_changedTicks.end(),
+        source.m_changedTicks.begin(),
+        source.m_changedTicks.end()
+    );
+}
+
+void ComponentColumn::fillGap(const size_t row)
+{
+    const size_t last = m_size - 1;
+    if (row != last) {
+        relocate(at(row), at(last));
+        m_addedTicks[row]   = m_addedTicks[last];
+        m_changedTicks[row] = m_changedTicks[last];
+    }
+    m_addedTicks.pop_back();
+    m_changedTicks.pop_back();
+    m_size--;
+}
+} // namespace siren::core
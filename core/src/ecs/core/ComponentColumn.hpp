@@ -0,0 +1,205 @@
+#pragma once
+
+#include "Component.hpp"
+#include "ComponentBitMap.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief Type erased information about a component type. Allows @ref ComponentColumn to move and
+ * destroy components without knowing their concrete type.
+ */
+struct ComponentTypeInfo
+{
+    /// @brief The ComponentBitMap index of this type.
+    size_t bitIndex;
+    /// @brief The size of a single component in bytes.
+    size_t size;
+    /// @brief The required alignment of a single component.
+    size_t alignment;
+    /// @brief Where components of this type are stored.
+    ComponentStorage storage;
+    /// @brief Whether the type is trivially copyable. Such components are relocated with memcpy,
+    /// need no destruction and may be copied as raw bytes, e.g. to serialize whole columns.
+    bool trivial;
+    /// @brief Move constructs a component into dst from src and then destroys src.
+    void (*relocate)(void* dst, void* src);
+    /// @brief Calls the destructor of the component.
+    void (*destroy)(void* ptr);
+    /// @brief Copy constructs a component into dst from src, nullptr if the type is not copy
+    /// constructible.
+    void (*copy)(void* dst, const void* src);
+
+    /// @brief Returns the type info of T. The returned pointer is valid for the whole program.
+    template <typename T>
+        requires(ComponentType<T>)
+    static const ComponentTypeInfo* get()
+    {
+        static_assert(
+            getComponentStorage<T>() != ComponentStorage::TAG || std::is_empty_v<T>,
+            "Tag components must not hold any data"
+        );
+        static const ComponentTypeInfo info{
+            .bitIndex = ComponentBitMap::getBitIndex<T>(),
+            .size = sizeof(T),
+            .alignment = alignof(T),
+            .storage = getComponentStorage<T>(),
+            .trivial = std::is_trivially_copyable_v<T>,
+            .relocate = [] (void* dst, void* src) {
+                if constexpr (std::is_trivially_copyable_v<T>) {
+                    std::memcpy(dst, src, sizeof(T));
+                } else {
+                    T* source = static_cast<T*>(src);
+                    new(dst) T(std::move(*source));
+                    source->~T();
+                }
+            },
+            .destroy = [] (void* ptr) { static_cast<T*>(ptr)->~T(); },
+            .copy = getCopy<T>(),
+        };
+        return &info;
+    }
+
+private:
+    template <typename T>
+    static constexpr auto getCopy() -> void (*)(void*, const void*)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            return [] (void* dst, const void* src) { std::memcpy(dst, src, sizeof(T)); };
+        } else if constexpr (std::is_copy_constructible_v<T>) {
+            return [] (void* dst, const void* src) { new(dst) T(*static_cast<const T*>(src)); };
+        } else {
+            return nullptr;
+        }
+    }
+};
+
+/// @brief Allocates on cache line boundaries, like the component storage of each column.
+template <typename T>
+struct CacheLineAllocator
+{
+    using value_type = T;
+
+    CacheLineAllocator() = default;
+
+    template <typename U>
+    CacheLineAllocator(const CacheLineAllocator<U>&) { }
+
+    T* allocate(const size_t count)
+    {
+        return static_cast<T*>(
+            ::operator new(count * sizeof(T), std::align_val_t{ CACHE_LINE_SIZE })
+        );
+    }
+
+    void deallocate(T* ptr, size_t) { ::operator delete(ptr, std::align_val_t{ CACHE_LINE_SIZE }); }
+
+    template <typename U>
+    bool operator==(const CacheLineAllocator<U>&) const { return true; }
+};
+
+/**
+ * @brief A contiguous, type erased array of a single component type. Used as a column of an
+ * @ref Archetype, meaning row i of every column in an archetype belongs to the same entity.
+ */
+class ComponentColumn
+{
+public:
+    explicit ComponentColumn(const ComponentTypeInfo* info);
+    ~ComponentColumn();
+
+    ComponentColumn(ComponentColumn&)            = delete;
+    ComponentColumn& operator=(ComponentColumn&) = delete;
+
+    /// @brief Returns the type info of the components stored in this column.
+    const ComponentTypeInfo* getTypeInfo() const { return m_info; }
+
+    /// @brief Returns the amount of components stored.
+    size_t size() const { return m_size; }
+
+    /// @brief Returns a pointer to the component at the given row. Performs no bounds checking.
+    void* at(const size_t row) const { return m_data + row * m_info->size; }
+
+    /// @brief Returns a typed pointer to the first component of this column.
+    template <typename T>
+    T* data() const
+    {
+        return reinterpret_cast<T*>(m_data);
+    }
+
+    /// @brief Returns the tick at which the component of each row was added.
+    u32* getAddedTicks() { return m_addedTicks.data(); }
+    const u32* getAddedTicks() const { return m_addedTicks.data(); }
+
+    /// @brief Returns the tick at which the component of each row was last accessed mutably.
+    u32* getChangedTicks() { return m_changedTicks.data(); }
+    const u32* getChangedTicks() const { return m_changedTicks.data(); }
+
+    /// @brief Marks the component at row as added, and therefore also changed, at tick.
+    void markAdded(const size_t row, const u32 tick)
+    {
+        m_addedTicks[row]   = tick;
+        m_changedTicks[row] = tick;
+    }
+
+    /// @brief Marks the component at row as changed at tick.
+    void markChanged(const size_t row, const u32 tick) { m_changedTicks[row] = tick; }
+
+    /// @brief Makes sure the column can hold at least capacity components without reallocating.
+    void reserve(size_t capacity);
+
+    /// @brief Appends an uninitialized slot and returns it. The caller must construct a component
+    /// into the slot before the column is used again.
+    void* pushUninitialized();
+
+    /// @brief Destroys the component at row and fills the gap with the last component.
+    void erase(size_t row);
+
+    /// @brief Relocates the component at row, including its ticks, into the already pushed
+    /// targetRow of target and fills the gap with the last component.
+    void moveTo(size_t row, ComponentColumn& target, size_t targetRow);
+
+    /// @brief Destroys all components, the storage is kept.
+    void clear();
+
+    /// @brief Appends copies of all components of source, which must store the same copyable type.
+    /// Trivially copyable components are copied with a single memcpy.
+    void append(const ComponentColumn& source);
+
+    /// @brief Marks all components as added at tick.
+    void markAllAdded(const u32 tick)
+    {
+        std::ranges::fill(m_addedTicks, tick);
+        std::ranges::fill(m_changedTicks, tick);
+    }
+
+private:
+    const ComponentTypeInfo* m_info;
+    byte* m_data      = nullptr;
+    size_t m_size     = 0;
+    size_t m_capacity = 0;
+    /// @brief Change detection ticks of each row, kept outside of the components so that scanning
+    /// them stays cheap. Cache line aligned, parallel iteration marks them from several threads.
+    std::vector<u32, CacheLineAllocator<u32>> m_addedTicks{ };
+    std::vector<u32, CacheLineAllocator<u32>> m_changedTicks{ };
+
+    /// @brief The alignment of the column storage, at least a cache line.
+    size_t getAllocationAlignment() const { return std::max(m_info->alignment, CACHE_LINE_SIZE); }
+
+    /// @brief Relocates a single component, inlining the memcpy of trivially copyable types.
+    void relocate(void* dst, void* src) const
+    {
+        if (m_info->trivial) {
+            std::memcpy(dst, src, m_info->size);
+        } else {
+            m_info->relocate(dst, src);
+        }
+    }
+
+    /// @brief Moves the last component into row and shrinks the column. Expects the component at
+    /// row to already be destroyed or relocated.
+    void fillGap(size_t row);
+};
+} // namespace siren::core
@@ -0,0 +1,281 @@
+#include "ComponentManager.hpp"
+
+#include <ranges>
+
+
+namespace siren::core
+{
+ComponentManager::ComponentManager()
+{
+    m_emptyArchetype = getCreateArchetype(ComponentMask{ });
+}
+
+void ComponentManager::destroy(const EntityHandle entity)
+{
+    EntityRecord* record = getRecord(entity);
+    if (!record) { return; }
+
+    if (record->sparse.any()) {
+        for (size_t bit = 0; bit < MAX_COMPONENTS; bit++) {
+            if (record->sparse.test(bit) && m_sparseSets[bit]) { m_sparseSets[bit]->erase(entity); }
+        }
+    }
+
+    const EntityHandle swapped = record->archetype->removeRow(record->row);
+    if (swapped) { m_records[swapped.index()].row = record->row; }
+
+    *record = EntityRecord{ };
+}
+
+void ComponentManager::apply(
+    const EntityHandle entity,
+    const ComponentMask removed,
+    const std::span<const StagedComponent> added
+)
+{
+    EntityRecord& record        = getCreateRecord(entity);
+    const ComponentMask current = record.archetype->getMask();
+
+    // sparse and tag components never move the entity, only archetype components decide the target
+    const ComponentMask removedSparse = removed & record.sparse;
+    if (removedSparse.any()) {
+        for (size_t bit = 0; bit < MAX_COMPONENTS; bit++) {
+            if (!removedSparse.test(bit)) { continue; }
+            record.sparse.reset(bit);
+            if (m_sparseSets[bit]) { m_sparseSets[bit]->erase(entity); }
+        }
+    }
+
+    ComponentMask target = current & ~removed;
+    for (const auto& staged : added) {
+        if (registerType(staged.info)->storage == ComponentStorage::ARCHETYPE) {
+            target.set(staged.info->bitIndex);
+        }
+    }
+
+    if (target != current) { moveEntity(record, *getCreateArchetype(target)); }
+
+    const u32 tick = getChangeTick();
+    for (const auto& [info, component] : added) {
+        if (info->storage != ComponentStorage::ARCHETYPE) {
+            // emplace never overwrites an existing component, removed ones are already gone
+            if (record.sparse.test(info->bitIndex) || info->storage == ComponentStorage::TAG) {
+                record.sparse.set(info->bitIndex);
+                info->destroy(component);
+                continue;
+            }
+            SparseSet& set = getCreateSparseSet(info);
+            const u32 row  = set.insertUninitialized(entity);
+            info->relocate(set.getColumn().at(row), component);
+            set.getColumn().markAdded(row, tick);
+            record.sparse.set(info->bitIndex);
+            continue;
+        }
+
+        ComponentColumn* column = record.archetype->getColumn(info->bitIndex);
+        void* slot              = column->at(record.row);
+        if (current.test(info->bitIndex)) {
+            // emplace never overwrites an existing component, unless it was removed beforehand
+            if (!removed.test(info->bitIndex)) {
+                info->destroy(component);
+                continue;
+            }
+            info->destroy(slot);
+        }
+        info->relocate(slot, component);
+        column->markAdded(record.row, tick);
+    }
+}
+
+const EntityQuery& ComponentManager::query(const ComponentMask components) const
+{
+    std::lock_guard lock{ m_queryMutex };
+    auto& query = m_queries[components];
+    if (!query) {
+        query = CreateOwn<EntityQuery>(components);
+        for (const auto& archetype : m_archetypes) { query->tryAddArchetype(archetype.get()); }
+    }
+    return *query;
+}
+
+ComponentManager::Snapshot ComponentManager::snapshot() const
+{
+    Snapshot snapshot{ .typeInfos = m_typeInfos };
+
+    ComponentMask copyable{ };
+    for (const ComponentTypeInfo* info : m_typeInfos) {
+        if (info && info->copy) { copyable.set(info->bitIndex); }
+    }
+
+    ComponentMask skipped{ };
+    HashMap<ComponentMask, Archetype*> targets{ };
+    for (const auto& archetype : m_archetypes) {
+        if (archetype->size() == 0) { continue; }
+
+        const ComponentMask mask = archetype->getMask() & copyable;
+        skipped |= archetype->getMask() & ~copyable;
+
+        Archetype*& target = targets[mask];
+        if (!target) {
+            snapshot.archetypes.push_back(CreateOwn<Archetype>(mask, m_typeInfos));
+            target = snapshot.archetypes.back().get();
+        }
+        target->append(*archetype);
+    }
+
+    for (size_t bit = 0; bit < MAX_COMPONENTS; bit++) {
+        if (!m_sparseSets[bit]) { continue; }
+        if (!copyable.test(bit)) {
+            skipped.set(bit);
+            continue;
+        }
+        snapshot.sparseSets[bit] = CreateOwn<SparseSet>(m_typeInfos[bit]);
+        snapshot.sparseSets[bit]->assign(*m_sparseSets[bit]);
+    }
+
+    snapshot.records = m_records;
+    for (EntityRecord& record : snapshot.records) { record.sparse &= copyable; }
+    for (const auto& archetype : snapshot.archetypes) { linkRecords(snapshot.records, *archetype); }
+
+    if (skipped.any()) {
+        wrn("Left {} non copyable component types out of the scene snapshot", skipped.count());
+    }
+    return snapshot;
+}
+
+void ComponentManager::restore(const Snapshot& snapshot)
+{
+    for (const ComponentTypeInfo* info : snapshot.typeInfos) {
+        if (info) { registerType(info); }
+    }
+    for (const auto& archetype : m_archetypes) { archetype->clear(); }
+    for (const auto& set : m_sparseSets) {
+        if (set) { set->clear(); }
+    }
+
+    const u32 tick = getChangeTick();
+    m_records      = snapshot.records;
+    for (const auto& source : snapshot.archetypes) {
+        Archetype* archetype = getCreateArchetype(source->getMask());
+        archetype->append(*source);
+        archetype->markAllAdded(tick);
+        linkRecords(m_records, *archetype);
+    }
+
+    for (size_t bit = 0; bit < MAX_COMPONENTS; bit++) {
+        if (!snapshot.sparseSets[bit]) { continue; }
+        SparseSet& set = getCreateSparseSet(m_typeInfos[bit]);
+        set.assign(*snapshot.sparseSets[bit]);
+        set.getColumn().markAllAdded(tick);
+    }
+}
+
+void ComponentManager::copyPrototypes(
+    const std::span<const EntityHandle> entities,
+    const Archetype& archetype,
+    const size_t firstRow,
+    const std::span<const PrototypeComponent> prototypes
+)
+{
+    const u32 tick = getChangeTick();
+    for (const auto& [info, component] : prototypes) {
+        switch (info->storage) {
+            case ComponentStorage::ARCHETYPE: {
+                ComponentColumn* column = archetype.getColumn(info->bitIndex);
+                for (size_t row = firstRow; row < firstRow + entities.size(); row++) {
+                    info->copy(column->at(row), component);
+                    column->markAdded(row, tick);
+                }
+                break;
+            }
+            case ComponentStorage::SPARSE: {
+                SparseSet& set = getCreateSparseSet(info);
+                for (const EntityHandle entity : entities) {
+                    const u32 row = set.insertUninitialized(entity);
+                    info->copy(set.getColumn().at(row), component);
+                    set.getColumn().markAdded(row, tick);
+                }
+                break;
+            }
+            case ComponentStorage::TAG: break; // the record bits are all there is to a tag
+        }
+    }
+}
+
+SparseSet& ComponentManager::getCreateSparseSet(const ComponentTypeInfo* info)
+{
+    Own<SparseSet>& set = m_sparseSets[info->bitIndex];
+    if (!set) { set = CreateOwn<SparseSet>(info); }
+    return *set;
+}
+
+ComponentManager::EntityRecord& ComponentManager::getCreateRecord(const EntityHandle entity)
+{
+    if (entity.index() >= m_records.size()) { m_records.resize(entity.index() + 1); }
+
+    EntityRecord& record = m_records[entity.index()];
+    if (!record.archetype) {
+        record.archetype = m_emptyArchetype;
+        record.row       = m_emptyArchetype->appendRow(entity);
+    }
+    return record;
+}
+
+Archetype* ComponentManager::getCreateArchetype(const ComponentMask mask)
+{
+    if (const auto it = m_maskToArchetype.find(mask); it != m_maskToArchetype.end()) {
+        return it->second;
+    }
+
+    // queries may be created concurrently by systems reading the scene
+    std::lock_guard lock{ m_queryMutex };
+    m_archetypes.push_back(CreateOwn<Archetype>(mask, m_typeInfos));
+    Archetype* archetype    = m_archetypes.back().get();
+    m_maskToArchetype[mask] = archetype;
+
+    for (const auto& query : m_queries | std::views::values) { query->tryAddArchetype(archetype); }
+
+    return archetype;
+}
+
+Archetype* ComponentManager::getAddTarget(Archetype& source, const size_t bitIndex)
+{
+    if (Archetype* target = source.getAddEdge(bitIndex)) { return target; }
+
+    Archetype* target = getCreateArchetype(ComponentMask{ source.getMask() }.set(bitIndex));
+    source.setAddEdge(bitIndex, target);
+    target->setRemoveEdge(bitIndex, &source);
+    return target;
+}
+
+Archetype* ComponentManager::getRemoveTarget(Archetype& source, const size_t bitIndex)
+{
+    if (Archetype* target = source.getRemoveEdge(bitIndex)) { return target; }
+
+    Archetype* target = getCreateArchetype(ComponentMask{ source.getMask() }.reset(bitIndex));
+    source.setRemoveEdge(bitIndex, target);
+    target->setAddEdge(bitIndex, &source);
+    return target;
+}
+
+void ComponentManager::moveEntity(EntityRecord& record, Archetype& target)
+{
+    EntityHandle swapped{ };
+    const size_t oldRow = record.row;
+
+    record.row       = record.archetype->moveRow(oldRow, target, swapped);
+    record.archetype = &target;
+
+    if (swapped) { m_records[swapped.index()].row = oldRow; }
+}
+
+void ComponentManager::linkRecords(Vector<EntityRecord>& records, Archetype& archetype)
+{
+    const Vector<EntityHandle>& entities = archetype.getEntities();
+    for (size_t row = 0; row < entities.size(); row++) {
+        EntityRecord& record = records[entities[row].index()];
+        record.archetype     = &archetype;
+        record.row           = row;
+    }
+}
+} // namespace siren::core
@@ -1,137 +1,406 @@
 #pragma once
 
-#include "ComponentList.hpp"
+#include "Archetype.hpp"
 #include "EntityManager.hpp"
+#include "EntityQuery.hpp"
+#include "SparseSet.hpp"
 #include "utilities/spch.hpp"
 
+#include <atomic>
+#include <mutex>
+#include <span>
+
 
 namespace siren::core
 {
 /**
  * @brief The ComponentManager is responsible for managing which exact Components belong to which
- * Entities. Furthermore, it provides lists of each component type.
+ * Entities. Components are stored in @ref Archetype's, so all entities with the same
+ * ComponentMask share contiguous columns and fetching a component is an index computation.
  */
 class ComponentManager
 {
 public:
+    using ComponentMask = EntityManager::ComponentMask;
+
+    /// @brief A fully constructed component waiting to be relocated into an entity.
+    struct StagedComponent
+    {
+        const ComponentTypeInfo* info;
+        void* component;
+    };
+
+    /// @brief A component that is copied into each entity created from it, see @ref Prefab. Unlike
+    /// a staged component it is never consumed.
+    struct PrototypeComponent
+    {
+        const ComponentTypeInfo* info;
+        void* component;
+    };
+
+    ComponentManager();
+
     /// @brief Create Component of type T and assign it to the provided entity. If the entity
     /// already has a component of this type, do nothing.
     template <typename T, typename... Args>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     T& emplace(const EntityHandle entity, Args&&... args)
     {
-        const size_t componentIndex = ComponentBitMap::getBitIndex<T>();
-        if (hasComponent<T>(entity)) {
-            ComponentList<T>& list       = getCreateComponentList<T>();
-            const ComponentHandle handle = m_entityToComponent[entity][componentIndex];
-            return list.get(handle);
-        }
+        const ComponentTypeInfo* info = registerType<T>();
+        EntityRecord& record          = getCreateRecord(entity);
 
-        ComponentList<T>& list = getCreateComponentList<T>();
+        if constexpr (getComponentStorage<T>() == ComponentStorage::TAG) {
+            static_assert(sizeof...(Args) == 0, "Tag components cannot be constructed from args");
+            record.sparse.set(info->bitIndex);
+            return getTag<T>();
+        } else if constexpr (getComponentStorage<T>() == ComponentStorage::SPARSE) {
+            SparseSet& set = getCreateSparseSet(info);
+            if (record.sparse.test(info->bitIndex)) {
+                return *static_cast<T*>(set.getColumn().at(set.find(entity)));
+            }
 
-        T& component                                       = list.emplace(std::forward<Args>(args)...);
-        m_componentToIndex[component.getComponentHandle()] = componentIndex;
-        m_entityToComponent[entity][componentIndex]        = component.getComponentHandle();
+            record.sparse.set(info->bitIndex);
+            const u32 row = set.insertUninitialized(entity);
+            set.getColumn().markAdded(row, getChangeTick());
+            return *new(set.getColumn().at(row)) T(std::forward<Args>(args)...);
+        } else {
+            if (ComponentColumn* column = record.archetype->getColumn(info->bitIndex)) {
+                return *static_cast<T*>(column->at(record.row));
+            }
 
-        return component;
+            Archetype* target = getAddTarget(*record.archetype, info->bitIndex);
+            moveEntity(record, *target);
+
+            ComponentColumn* column = target->getColumn(info->bitIndex);
+            column->markAdded(record.row, getChangeTick());
+            return *new(column->at(record.row)) T(std::forward<Args>(args)...);
+        }
     }
 
     /// @brief Removes the Component of type T from entity. If entity does not have a component of
     /// type T, do nothing.
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     void remove(const EntityHandle entity)
     {
-        if (!hasComponent<T>(entity)) { return; }
+        const size_t componentIndex = ComponentBitMap::getBitIndex<T>();
+        EntityRecord* record        = getRecord(entity);
+        if (!record) { return; }
 
-        const size_t componentIndex     = ComponentBitMap::getBitIndex<T>();
-        ComponentHandle componentHandle = m_entityToComponent[entity][componentIndex];
-        ComponentList<T>& list          = getCreateComponentList<T>();
+        if constexpr (getComponentStorage<T>() != ComponentStorage::ARCHETYPE) {
+            if (!record->sparse.test(componentIndex)) { return; }
+            record->sparse.reset(componentIndex);
+            if (SparseSet* set = m_sparseSets[componentIndex].get()) { set->erase(entity); }
+        } else {
+            if (!record->archetype->has(componentIndex)) { return; }
 
-        m_componentToIndex.erase(componentHandle);
-        m_entityToComponent[entity][componentIndex] = INVALID_COMPONENT;
-        list.remove(componentHandle);
+            Archetype* target = getRemoveTarget(*record->archetype, componentIndex);
+            moveEntity(*record, *target);
+        }
     }
 
-    /// @brief Should be called each time an entity is destroyed. Removes all state stored about
-    /// this entity.
-    void destroy(const EntityHandle entity)
+    /**
+     * @brief Stores the new entities, which must not have any components yet, in the archetype of
+     * exactly the components Ts. Storage is reserved once for all entities. construct is called
+     * with each entity and pointers to its uninitialized components and must construct all of
+     * them.
+     */
+    template <typename... Ts, typename Fn>
+        requires((ComponentType<Ts> && ...))
+    void createMany(const std::span<const EntityHandle> entities, Fn&& construct)
+    {
+        createMany<Ts...>(entities, { }, std::forward<Fn>(construct));
+    }
+
+    /**
+     * @brief Like createMany() above, but every entity additionally receives a copy of each
+     * prototype. The prototypes are copied one column at a time after all entities have been
+     * stored, which for trivially copyable components amounts to a series of memcpy's.
+     */
+    template <typename... Ts, typename Fn>
+        requires((ComponentType<Ts> && ...))
+    void createMany(
+        const std::span<const EntityHandle> entities,
+        const std::span<const PrototypeComponent> prototypes,
+        Fn&& construct
+    )
     {
-        if (!m_entityToComponent.contains(entity)) { return; }
+        static_assert(
+            ((getComponentStorage<Ts>() == ComponentStorage::ARCHETYPE) && ...),
+            "Only archetype stored components can be constructed in bulk"
+        );
+        if (entities.empty()) { return; }
 
-        for (const auto& componentHandle : m_entityToComponent[entity]) {
-            if (componentHandle == INVALID_COMPONENT) { continue; }
-            const size_t index = m_componentToIndex[componentHandle];
-            m_components[index]->remove(componentHandle);
-            m_componentToIndex.erase(componentHandle);
+        ComponentMask mask{ };
+        (mask.set(registerType<Ts>()->bitIndex), ...);
+        ComponentMask sparse{ };
+        size_t archetypePrototypes = 0;
+        for (const auto& [info, component] : prototypes) {
+            SirenAssert(info->copy, "Cannot create entities from a non copyable prototype");
+            if (registerType(info)->storage == ComponentStorage::ARCHETYPE) {
+                mask.set(info->bitIndex);
+                archetypePrototypes++;
+            } else {
+                sparse.set(info->bitIndex);
+            }
         }
+        SirenAssert(
+            mask.count() == sizeof...(Ts) + archetypePrototypes &&
+            sparse.count() == prototypes.size() - archetypePrototypes,
+            "Cannot create entities with duplicate components"
+        );
 
-        m_entityToComponent.erase(entity);
-    }
+        Archetype* archetype = getCreateArchetype(mask);
+        const size_t firstRow = archetype->size();
+        archetype->reserve(firstRow + entities.size());
 
-    /// @brief An unsafe get of the component of type T associated with the given entity
-    template <typename T>
-        requires(std::is_base_of_v<Component, T>)
-    T& get(const EntityHandle entity)
-    {
-        const size_t componentIndex  = ComponentBitMap::getBitIndex<T>();
-        const ComponentHandle handle = m_entityToComponent.at(entity)[componentIndex];
-        ComponentList<T>& list       = getCreateComponentList<T>();
-        return list.get(handle);
+        const u32 maxIndex = std::ranges::max(entities, { }, &EntityHandle::index).index();
+        if (maxIndex >= m_records.size()) { m_records.resize(maxIndex + 1); }
+
+        const u32 tick = getChangeTick();
+        const std::tuple columns{ archetype->getColumn(ComponentBitMap::getBitIndex<Ts>())... };
+        for (const EntityHandle entity : entities) {
+            SirenAssert(!getRecord(entity), "Entity {} already has components", entity);
+            const size_t row = archetype->appendRow(entity);
+            std::apply(
+                [&] (auto*... column) {
+                    (column->markAdded(row, tick), ...);
+                    construct(entity, static_cast<Ts*>(column->at(row))...);
+                },
+                columns
+            );
+            m_records[entity.index()] = EntityRecord{ archetype, row, sparse };
+        }
+
+        if (!prototypes.empty()) { copyPrototypes(entities, *archetype, firstRow, prototypes); }
     }
 
-    /// @brief An unsafe get of the component of type T associated with the given entity
+    /**
+     * @brief Applies several component changes to entity with a single archetype move. Components
+     * in removed are destroyed. Each staged component is relocated into the entity, unless the
+     * entity already has a component of that type, in which case the staged one is destroyed.
+     * Either way the staged components are consumed.
+     */
+    void apply(EntityHandle entity, ComponentMask removed, std::span<const StagedComponent> added);
+
+    /// @brief Should be called each time an entity is destroyed. Removes all state stored about
+    /// this entity.
+    void destroy(EntityHandle entity);
+
+    /// @brief An unsafe get of the component of type T associated with the given entity. Marks
+    /// the component as changed unless T is const.
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     T& get(const EntityHandle entity) const
     {
-        const size_t componentIndex  = ComponentBitMap::getBitIndex<T>();
-        const ComponentHandle handle = m_entityToComponent.at(entity)[componentIndex];
-        ComponentList<T>& list       = getCreateComponentList<T>();
-        return list.get(handle);
+        if constexpr (getComponentStorage<T>() != ComponentStorage::ARCHETYPE) {
+            T* component = GetSafe<T>(entity);
+            SirenAssert(component, "Failed to get Component from ComponentManager");
+            return *component;
+        } else {
+            const size_t componentIndex = ComponentBitMap::getBitIndex<T>();
+            const EntityRecord& record  = m_records[entity.index()];
+            ComponentColumn* column     = record.archetype->getColumn(componentIndex);
+            SirenAssert(column, "Failed to get Component from ComponentManager");
+            if constexpr (!std::is_const_v<T>) { column->markChanged(record.row, getChangeTick()); }
+            return *static_cast<T*>(column->at(record.row));
+        }
     }
 
-    /// @brief A safe get of the component of type T associated with the given entity
+    /// @brief A safe get of the component of type T associated with the given entity. Marks the
+    /// component as changed unless T is const.
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     T* GetSafe(const EntityHandle entity) const
     {
-        const size_t componentIndex  = ComponentBitMap::getBitIndex<T>();
-        const ComponentHandle handle = m_entityToComponent.at(entity)[componentIndex];
-        ComponentList<T>& list       = getCreateComponentList<T>();
-        return list.GetSafe(handle);
+        const size_t componentIndex = ComponentBitMap::getBitIndex<T>();
+        const EntityRecord* record  = getRecord(entity);
+        if (!record) { return nullptr; }
+
+        if constexpr (getComponentStorage<T>() == ComponentStorage::TAG) {
+            return record->sparse.test(componentIndex) ? &getTag<T>() : nullptr;
+        } else if constexpr (getComponentStorage<T>() == ComponentStorage::SPARSE) {
+            if (!record->sparse.test(componentIndex)) { return nullptr; }
+            SparseSet* set = m_sparseSets[componentIndex].get();
+            const u32 row  = set->find(entity);
+            if constexpr (!std::is_const_v<T>) {
+                set->getColumn().markChanged(row, getChangeTick());
+            }
+            return static_cast<T*>(set->getColumn().at(row));
+        } else {
+            ComponentColumn* column = record->archetype->getColumn(componentIndex);
+            if (!column) { return nullptr; }
+            if constexpr (!std::is_const_v<T>) {
+                column->markChanged(record->row, getChangeTick());
+            }
+            return static_cast<T*>(column->at(record->row));
+        }
     }
 
     /// @brief Checks if the entity has this component type.
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     bool hasComponent(const EntityHandle entity) const
     {
         const size_t componentIndex = ComponentBitMap::getBitIndex<T>();
-        if (!m_entityToComponent.contains(entity)) { return false; }
-        return m_entityToComponent.at(entity)[componentIndex] != INVALID_COMPONENT;
+        const EntityRecord* record  = getRecord(entity);
+        if (!record) { return false; }
+        if constexpr (getComponentStorage<T>() != ComponentStorage::ARCHETYPE) {
+            return record->sparse.test(componentIndex);
+        } else {
+            return record->archetype->has(componentIndex);
+        }
     }
 
+    /// @brief Returns the bits of the sparse and tag components entity has.
+    ComponentMask getSparseMask(const EntityHandle entity) const
+    {
+        const EntityRecord* record = getRecord(entity);
+        return record ? record->sparse : ComponentMask{ };
+    }
+
+    /// @brief Returns the sparse set storing the components with the given bit index, or nullptr
+    /// if no such component has been added yet.
+    const SparseSet* getSparseSet(const size_t bitIndex) const
+    {
+        return m_sparseSets[bitIndex].get();
+    }
+
+    /// @brief Returns the persistent query of all entities whose components are a superset of the
+    /// given mask. The query is created on first use and kept up to date afterwards.
+    const EntityQuery& query(ComponentMask components) const;
+
+    /// @brief Returns the current change tick, which all added and mutably accessed components are
+    /// stamped with.
+    u32 getChangeTick() const { return m_changeTick.load(std::memory_order_relaxed); }
+
+    /// @brief Advances the change tick and returns its previous value. Components stamped after
+    /// this call compare greater than the returned tick.
+    u32 advanceChangeTick() { return m_changeTick.fetch_add(1, std::memory_order_relaxed); }
+
+    /// @brief A copy of all components, see Scene::Snapshot().
+    struct Snapshot;
+
+    /**
+     * @brief Copies all components as whole columns, trivially copyable columns with a single
+     * memcpy each. Components whose type is not copy constructible are left out and reported.
+     * Archetypes which only differ by such components are merged in the snapshot.
+     */
+    Snapshot snapshot() const;
+
+    /**
+     * @brief Replaces all components with copies of the snapshot's. Existing archetypes are
+     * emptied but kept, so that queries stay valid. All restored components are marked as added
+     * at the current change tick.
+     */
+    void restore(const Snapshot& snapshot);
+
+private:
+    /// @brief The location of an entity's components.
+    struct EntityRecord
+    {
+        Archetype* archetype = nullptr;
+        size_t row           = 0;
+        /// @brief The sparse and tag components of the entity, which its archetype does not store.
+        ComponentMask sparse{ };
+    };
+
+public:
+    struct Snapshot
+    {
+        Archetype::TypeInfos typeInfos{ };
+        /// @brief Each archetype has a distinct mask, empty archetypes are not copied.
+        Vector<Own<Archetype>> archetypes{ };
+        Array<Own<SparseSet>, MAX_COMPONENTS> sparseSets{ };
+        /// @brief The records of the snapshot, pointing into its own archetypes.
+        Vector<EntityRecord> records{ };
+    };
+
 private:
-    /// @brief All the component lists
-    mutable Array<Ref<IComponentList>, MAX_COMPONENTS> m_components{ };
-    /// @brief Mapping of EntityHandle to its assigned componentID's. Indexing into the vector is
-    /// done by taking the component types index via the ComponentBitMap.
-    HashMap<EntityHandle, Array<ComponentHandle, MAX_COMPONENTS>> m_entityToComponent{ };
-    // HACK: this is a terrible solution, but cant think of anything better for now
-    /// @brief A mapping of each ComponentHandle to it index into m_components
-    HashMap<ComponentHandle, size_t> m_componentToIndex{ };
-
-    /// @brief Returns a list reference of type T.
+
+    /// @brief All archetypes, never shrinks so that pointers into it stay stable.
+    Vector<Own<Archetype>> m_archetypes{ };
+    /// @brief Lookup of archetypes via their mask.
+    HashMap<ComponentMask, Archetype*> m_maskToArchetype{ };
+    /// @brief The archetype without any components, entities live here after their first emplace
+    /// until they receive a component.
+    Archetype* m_emptyArchetype = nullptr;
+    /// @brief Type information of every component type registered so far, indexed by bit index.
+    Archetype::TypeInfos m_typeInfos{ };
+    /// @brief The storage of each component type with ComponentStorage::SPARSE, indexed by bit
+    /// index. Created on first use.
+    Array<Own<SparseSet>, MAX_COMPONENTS> m_sparseSets{ };
+    /// @brief The location of each entity's components, indexed by the entity's index. Records are
+    /// not generation checked, callers are expected to only pass alive entities.
+    Vector<EntityRecord> m_records{ };
+    /// @brief All queries created so far, updated each time a new archetype is created.
+    mutable HashMap<ComponentMask, Own<EntityQuery>> m_queries{ };
+    /// @brief Guards m_queries and m_archetypes, systems of the same phase may query
+    /// concurrently.
+    mutable std::mutex m_queryMutex{ };
+    /// @brief The current change tick. Starts at 1 so that a tick of 0 means "since forever".
+    std::atomic<u32> m_changeTick{ 1 };
+
+    /// @brief Registers the type information of T so that archetypes containing T can be created.
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
-    ComponentList<T>& getCreateComponentList() const
+        requires(ComponentType<T>)
+    const ComponentTypeInfo* registerType()
     {
-        const size_t componentIndex = ComponentBitMap::getBitIndex<T>();
-        if (!m_components[componentIndex]) {
-            m_components[componentIndex] = CreateRef<ComponentList<T>>();
-        }
-        return static_cast<ComponentList<T>&>(*m_components[componentIndex]);
+        return registerType(ComponentTypeInfo::get<T>());
+    }
+
+    /// @brief Registers the type information so that archetypes containing the type can be
+    /// created.
+    const ComponentTypeInfo* registerType(const ComponentTypeInfo* info)
+    {
+        m_typeInfos[info->bitIndex] = info;
+        return info;
+    }
+
+    /// @brief Returns the record of entity, or nullptr if entity has no components stored.
+    const EntityRecord* getRecord(const EntityHandle entity) const
+    {
+        if (entity.index() >= m_records.size()) { return nullptr; }
+        const EntityRecord& record = m_records[entity.index()];
+        return record.archetype ? &record : nullptr;
     }
+
+    /// @brief Returns the record of entity, or nullptr if entity has no components stored.
+    EntityRecord* getRecord(const EntityHandle entity)
+    {
+        const auto* self = static_cast<const ComponentManager*>(this);
+        return const_cast<EntityRecord*>(self->getRecord(entity));
+    }
+
+    /// @brief Returns the instance shared by all entities with the tag component T.
+    template <typename T>
+    static T& getTag()
+    {
+        static std::remove_const_t<T> tag{ };
+        return tag;
+    }
+
+    /// @brief Copies each prototype into the entities, whose archetype components occupy the rows
+    /// starting at firstRow of archetype.
+    void copyPrototypes(
+        std::span<const EntityHandle> entities,
+        const Archetype& archetype,
+        size_t firstRow,
+        std::span<const PrototypeComponent> prototypes
+    );
+    /// @brief Returns the sparse set of the given component type, creating it if necessary.
+    SparseSet& getCreateSparseSet(const ComponentTypeInfo* info);
+    /// @brief Returns the record of entity, placing it in the empty archetype if it has none.
+    EntityRecord& getCreateRecord(EntityHandle entity);
+    /// @brief Returns the archetype with the exact given mask, creating it if necessary.
+    Archetype* getCreateArchetype(ComponentMask mask);
+    /// @brief Returns the archetype reached by adding the component bit to source.
+    Archetype* getAddTarget(Archetype& source, size_t bitIndex);
+    /// @brief Returns the archetype reached by removing the component bit from source.
+    Archetype* getRemoveTarget(Archetype& source, size_t bitIndex);
+    /// @brief Moves the entity described by record into target and updates all affected records.
+    void moveEntity(EntityRecord& record, Archetype& target);
+    /// @brief Points the records of all entities stored in archetype at their rows.
+    static void linkRecords(Vector<EntityRecord>& records, Archetype& archetype);
 };
-} // namespace siren::ecs
+} // namespace siren::core
@@ -0,0 +1,338 @@
+#pragma once
+
+#include "ComponentManager.hpp"
+#include "EntityQuery.hpp"
+#include "core/ThreadPool.hpp"
+#include "utilities/spch.hpp"
+
+#include <numeric>
+
+
+namespace siren::core
+{
+/**
+ * @brief A typed view over an @ref EntityQuery. Hands out references to the components of each
+ * matching entity straight from the archetype columns, without any lookups or allocations.
+ *
+ * Visiting an entity marks its non-const components as changed at the view's tick, so request
+ * components that are only read as const (e.g. ComponentView<const TransformComponent>).
+ *
+ * Sparse and tag components (see ComponentStorage) are not part of any archetype. They are checked
+ * and looked up per visited entity instead, so a view should request at least one archetype stored
+ * component to narrow down the visited archetypes.
+ *
+ * @note Adding or removing components, or destroying entities, while iterating a view moves
+ * entities between archetypes and invalidates the view's iterators and references.
+ */
+template <typename... Ts>
+    requires(sizeof...(Ts) > 0 && (ComponentType<Ts> && ...))
+class ComponentView
+{
+public:
+    /// @brief Which entities a view visits, based on the ticks of its first component type.
+    enum class Filter
+    {
+        /// @brief Visits all matching entities.
+        ALL,
+        /// @brief Only visits entities whose first component was added after the since tick.
+        ADDED,
+        /// @brief Only visits entities whose first component was added or changed after the since
+        /// tick.
+        CHANGED,
+    };
+
+    /// @brief Creates a view over query, which must match the archetype stored components of Ts.
+    /// Visited non-const components are marked as changed at tick.
+    ComponentView(
+        const ComponentManager& components,
+        const EntityQuery& query,
+        const u32 tick,
+        const Filter filter = Filter::ALL,
+        const u32 since     = 0
+    )
+        : m_components(&components), m_query(&query), m_tick(tick), m_filter(filter), m_since(since)
+    {
+        (addSparseBit<Ts>(), ...);
+    }
+
+    /// @brief Calls fn for each matching entity. fn may either take (EntityHandle, Ts&...) or only
+    /// the components (Ts&...).
+    template <typename Fn>
+    void each(Fn&& fn) const
+    {
+        for (const Archetype* archetype : m_query->getArchetypes()) {
+            eachRow(*archetype, 0, archetype->size(), fn);
+        }
+    }
+
+    /**
+     * @brief Like each(), but splits the matching archetypes into chunks of rows and processes the
+     * chunks concurrently on pool. Chunk boundaries fall on cache line boundaries of every
+     * requested column and of its change ticks, so no two threads ever write to the same cache
+     * line. fn must be safe to
+     * call concurrently for different entities.
+     */
+    template <typename Fn>
+    void parallelEach(ThreadPool& pool, Fn&& fn) const
+    {
+        struct Chunk
+        {
+            const Archetype* archetype;
+            size_t begin;
+            size_t end;
+        };
+
+        const size_t chunkRows = getChunkRows();
+        Vector<Chunk> chunks;
+        for (const Archetype* archetype : m_query->getArchetypes()) {
+            for (size_t begin = 0; begin < archetype->size(); begin += chunkRows) {
+                const size_t end = std::min(archetype->size(), begin + chunkRows);
+                chunks.push_back({ archetype, begin, end });
+            }
+        }
+
+        pool.parallelFor(
+            chunks.size(),
+            1,
+            [this, &chunks, &fn] (const size_t first, const size_t last) {
+                for (size_t i = first; i < last; i++) {
+                    const Chunk& chunk = chunks[i];
+                    eachRow(*chunk.archetype, chunk.begin, chunk.end, fn);
+                }
+            }
+        );
+    }
+
+    /**
+     * @brief Forward iterator yielding a tuple of the entity and references to its components.
+     */
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::tuple<EntityHandle, Ts&...>;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = value_type;
+
+        Iterator() = default;
+
+        Iterator(const ComponentView* view, const size_t archetype)
+            : m_view(view), m_archetype(archetype)
+        {
+            seek();
+        }
+
+        value_type operator*() const
+        {
+            markChanged(m_changedTicks, m_row, m_view->m_tick);
+            const EntityHandle entity = m_entities[m_row];
+            return std::apply(
+                [this, entity] (Ts*... columns) -> value_type {
+                    return { entity, m_view->getComponent(columns, m_row, entity)... };
+                },
+                m_columns
+            );
+        }
+
+        Iterator& operator++()
+        {
+            m_row++;
+            seek();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const Iterator& o) const
+        {
+            return m_archetype == o.m_archetype && m_row == o.m_row;
+        }
+
+    private:
+        const ComponentView* m_view    = nullptr;
+        size_t m_archetype             = 0;
+        size_t m_row                   = 0;
+        size_t m_count                 = 0;
+        const EntityHandle* m_entities = nullptr;
+        const u32* m_filterTicks       = nullptr;
+        std::tuple<Ts*...> m_columns{ };
+        std::array<u32*, sizeof...(Ts)> m_changedTicks{ };
+
+        /// @brief Advances to the next row passing the view's filter, moving on to the next
+        /// archetypes as needed and caching their column pointers.
+        void seek()
+        {
+            const Vector<Archetype*>& archetypes = m_view->m_query->getArchetypes();
+            while (m_archetype < archetypes.size()) {
+                if (!m_entities) {
+                    const Archetype* archetype = archetypes[m_archetype];
+                    m_count                    = archetype->size();
+                    m_entities                 = archetype->getEntities().data();
+                    m_filterTicks              = m_view->getFilterTicks(*archetype);
+                    m_columns                  = getColumns(*archetype);
+                    m_changedTicks             = getChangedTicks(*archetype);
+                }
+                while (m_row < m_count && !m_view->passes(m_filterTicks, m_entities, m_row)) {
+                    m_row++;
+                }
+                if (m_row < m_count) { return; }
+
+                m_row      = 0;
+                m_entities = nullptr;
+                m_archetype++;
+            }
+        }
+    };
+
+    Iterator begin() const { return Iterator{ this, 0 }; }
+    Iterator end() const { return Iterator{ this, m_query->getArchetypes().size() }; }
+
+private:
+    /// @brief The changed ticks of each requested column, nullptr for const components.
+    using ChangedTicks = std::array<u32*, sizeof...(Ts)>;
+
+    /// @brief Whether any requested component is stored outside of the archetypes.
+    static constexpr bool HAS_SPARSE =
+        ((getComponentStorage<Ts>() != ComponentStorage::ARCHETYPE) || ...);
+
+    /// @brief The approximate amount of bytes of the largest component processed per chunk.
+    static constexpr size_t CHUNK_BYTES = 16 * 1024;
+
+    const ComponentManager* m_components;
+    const EntityQuery* m_query;
+    /// @brief The bits of the requested sparse and tag components.
+    ComponentManager::ComponentMask m_sparse{ };
+    u32 m_tick;
+    Filter m_filter;
+    u32 m_since;
+
+    /// @brief Calls fn for the rows [begin, end) of archetype that pass the filter.
+    template <typename Fn>
+    void eachRow(const Archetype& archetype, const size_t begin, const size_t end, Fn& fn) const
+    {
+        if (begin >= end) { return; }
+
+        const EntityHandle* entities = archetype.getEntities().data();
+        const u32* filterTicks       = getFilterTicks(archetype);
+        const ChangedTicks changed   = getChangedTicks(archetype);
+        std::apply(
+            [&] (Ts*... columns) {
+                for (size_t row = begin; row < end; row++) {
+                    if (!passes(filterTicks, entities, row)) { continue; }
+                    markChanged(changed, row, m_tick);
+                    const EntityHandle entity = entities[row];
+                    if constexpr (std::is_invocable_v<Fn&, EntityHandle, Ts&...>) {
+                        fn(entity, getComponent(columns, row, entity)...);
+                    } else {
+                        fn(getComponent(columns, row, entity)...);
+                    }
+                }
+            },
+            getColumns(archetype)
+        );
+    }
+
+    /// @brief Returns the ticks of the first component the filter compares against, or nullptr if
+    /// the view is unfiltered.
+    const u32* getFilterTicks(const Archetype& archetype) const
+    {
+        using First = std::tuple_element_t<0, std::tuple<Ts...>>;
+        if (m_filter == Filter::ALL) { return nullptr; }
+        if constexpr (getComponentStorage<First>() != ComponentStorage::ARCHETYPE) {
+            SirenAssert(false, "Only archetype stored components can be filtered by ticks");
+            return nullptr;
+        }
+        const ComponentColumn* column = archetype.getColumn(ComponentBitMap::getBitIndex<First>());
+        return m_filter == Filter::ADDED ? column->getAddedTicks() : column->getChangedTicks();
+    }
+
+    /// @brief Checks if row passes the filter described by filterTicks and its entity has all
+    /// requested sparse and tag components.
+    bool passes(const u32* filterTicks, const EntityHandle* entities, const size_t row) const
+    {
+        if (filterTicks && filterTicks[row] <= m_since) { return false; }
+        if constexpr (HAS_SPARSE) {
+            return (m_components->getSparseMask(entities[row]) & m_sparse) == m_sparse;
+        }
+        return true;
+    }
+
+    /// @brief Adds the bit of T to m_sparse if T is stored outside of the archetypes.
+    template <typename T>
+    void addSparseBit()
+    {
+        if constexpr (getComponentStorage<T>() != ComponentStorage::ARCHETYPE) {
+            m_sparse.set(ComponentBitMap::getBitIndex<T>());
+        }
+    }
+
+    /// @brief Returns the component T of entity, which sits at row if T is archetype stored.
+    template <typename T>
+    T& getComponent(T* column, const size_t row, const EntityHandle entity) const
+    {
+        if constexpr (getComponentStorage<T>() == ComponentStorage::ARCHETYPE) {
+            return column[row];
+        } else {
+            return m_components->get<T>(entity);
+        }
+    }
+
+    /// @brief Stamps the non-const components of row with tick.
+    static void markChanged(const ChangedTicks& changed, const size_t row, const u32 tick)
+    {
+        for (u32* ticks : changed) {
+            if (ticks) { ticks[row] = tick; }
+        }
+    }
+
+    /// @brief Returns the changed ticks of each requested column, nullptr for const components.
+    static ChangedTicks getChangedTicks(const Archetype& archetype)
+    {
+        return { getChangedTicks<Ts>(archetype)... };
+    }
+
+    template <typename T>
+    static u32* getChangedTicks(const Archetype& archetype)
+    {
+        // sparse components are marked by the component manager when they are looked up
+        constexpr bool archetypeStored = getComponentStorage<T>() == ComponentStorage::ARCHETYPE;
+        if constexpr (std::is_const_v<T> || !archetypeStored) {
+            return nullptr;
+        } else {
+            return archetype.getColumn(ComponentBitMap::getBitIndex<T>())->getChangedTicks();
+        }
+    }
+
+    /// @brief Returns the amount of rows per parallel chunk. Always a multiple of the amount of
+    /// rows after which every column and its change ticks reach a cache line boundary again.
+    static constexpr size_t getChunkRows()
+    {
+        constexpr auto rowsPerLine = [] (const size_t size) {
+            return CACHE_LINE_SIZE / std::gcd(size, CACHE_LINE_SIZE);
+        };
+        size_t alignedRows = rowsPerLine(sizeof(u32));
+        ((alignedRows = std::lcm(alignedRows, rowsPerLine(sizeof(Ts)))), ...);
+        const size_t targetRows = std::max<size_t>(CHUNK_BYTES / std::max({ sizeof(Ts)... }), 1);
+        return (targetRows + alignedRows - 1) / alignedRows * alignedRows;
+    }
+
+    /// @brief Returns the first element of each requested column of the archetype, nullptr for
+    /// components stored outside of the archetypes.
+    static std::tuple<Ts*...> getColumns(const Archetype& archetype)
+    {
+        return { getColumn<Ts>(archetype)... };
+    }
+
+    template <typename T>
+    static T* getColumn(const Archetype& archetype)
+    {
+        if constexpr (getComponentStorage<T>() != ComponentStorage::ARCHETYPE) { return nullptr; }
+        else return archetype.getColumn(ComponentBitMap::getBitIndex<T>())->template data<T>();
+    }
+};
+} // namespace siren::core
@@ -1,6 +1,19 @@
 #pragma once
 
+#include <cstddef>
+
 // TODO: this should probably be put into a Properties config struct we pass to scene on creation
 
-/// @brief The max amount of components a Scene can handle.
-constexpr int MAX_COMPONENTS = 32;
+// configurable via the SIREN_MAX_COMPONENTS cmake cache variable
+#ifndef SIREN_MAX_COMPONENTS
+#define SIREN_MAX_COMPONENTS 64
+#endif
+
+/// @brief The max amount of components a Scene can handle. ComponentMask's are bitsets of this
+/// size, so multiples of 64 make full use of each word.
+constexpr size_t MAX_COMPONENTS = SIREN_MAX_COMPONENTS;
+static_assert(MAX_COMPONENTS > 0, "MAX_COMPONENTS must be positive");
+
+/// @brief The assumed size of a cache line. Component columns are aligned to it, so that parallel
+/// iteration can split them into chunks that never share a cache line.
+constexpr size_t CACHE_LINE_SIZE = 64;
@@ -1,11 +1,83 @@
 #pragma once
 
-#include "utilities/UUID.hpp"
+#include "utilities/spch.hpp"
+
 
 namespace siren::core
 {
 
-/// @brief A UUID representing an entity
-using EntityHandle = utilities::UUID;
+/**
+ * @brief A dense, generational 32-bit handle representing an entity.
+ *
+ * The lower ENTITY_INDEX_BITS bits are an index into the ECS's internal arrays, which are reused
+ * once an entity is destroyed. The upper ENTITY_GENERATION_BITS bits are a generation counter that
+ * is incremented on each reuse of an index, so stale handles can be detected with a single compare.
+ *
+ * @note Handles are only meaningful at runtime. For a stable, persistent identity (serialization,
+ * editor) use the UUID stored in the entity's @ref IDComponent.
+ */
+class EntityHandle
+{
+public:
+    /// @brief The amount of bits used for the index, allows for ~1 million alive entities.
+    static constexpr u32 ENTITY_INDEX_BITS = 20;
+    /// @brief The amount of bits used for the generation.
+    static constexpr u32 ENTITY_GENERATION_BITS = 32 - ENTITY_INDEX_BITS;
+    /// @brief The largest valid index.
+    static constexpr u32 MAX_INDEX = (1u << ENTITY_INDEX_BITS) - 2;
+    /// @brief The largest generation before wrapping around.
+    static constexpr u32 MAX_GENERATION = (1u << ENTITY_GENERATION_BITS) - 1;
+
+    /// @brief Creates an invalid handle.
+    constexpr EntityHandle() = default;
+
+    /// @brief Creates a handle from an index and a generation.
+    constexpr EntityHandle(const u32 index, const u32 generation)
+        : m_id((generation << ENTITY_INDEX_BITS) | (index & INDEX_MASK)) { }
+
+    /// @brief Returns an invalid handle that does not reference any entity.
+    static constexpr EntityHandle invalid() { return EntityHandle{ }; }
+
+    /// @brief Returns the index part of this handle.
+    constexpr u32 index() const { return m_id & INDEX_MASK; }
+
+    /// @brief Returns the generation part of this handle.
+    constexpr u32 generation() const { return m_id >> ENTITY_INDEX_BITS; }
+
+    /// @brief Returns the underlying packed value of this handle.
+    constexpr u32 id() const { return m_id; }
 
-} // namespace siren::ecs
\ No newline at end of file
+    constexpr bool operator==(const EntityHandle&) const = default;
+    constexpr bool operator<(const EntityHandle& o) const { return m_id < o.m_id; }
+    constexpr explicit operator bool() const { return m_id != INVALID_ID; }
+
+private:
+    static constexpr u32 INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;
+    static constexpr u32 INVALID_ID = ~0u;
+
+    u32 m_id = INVALID_ID;
+};
+
+} // namespace siren::core
+
+// make EntityHandle hashable and usable as a key in hash maps
+template <>
+struct std::hash<siren::core::EntityHandle>
+{
+    size_t operator()(const siren::core::EntityHandle& entity) const noexcept
+    {
+        return ::std::hash<uint32_t>{ }(entity.id());
+    }
+};
+
+template <>
+struct std::formatter<siren::core::EntityHandle> : std::formatter<std::string>
+{
+    auto format(const siren::core::EntityHandle& entity, std::format_context& ctx) const
+    {
+        return std::formatter<std::string>::format(
+            std::format("{}v{}", entity.index(), entity.generation()),
+            ctx
+        );
+    }
+};
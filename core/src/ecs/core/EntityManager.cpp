@@ -6,42 +6,94 @@ namespace siren::core
 
 EntityHandle EntityManager::create()
 {
-    const EntityHandle e = EntityHandle::create();
+    const EntityHandle entity = reserve();
+    activate(entity);
+    return entity;
+}
+
+Vector<EntityHandle> EntityManager::createMany(const size_t count)
+{
+    Vector<EntityHandle> entities;
+    entities.reserve(count);
 
-    SirenAssert(e, "Created invalid entity (idk how).");
-    SirenAssert(!m_entityToMask.contains(e), "Created already existing entity");
-    SirenAssert(!m_entityToIndex.contains(e), "Created already existing entity");
+    {
+        std::lock_guard lock{ m_reserveMutex };
+        while (entities.size() < count && !m_freeIndices.empty()) {
+            entities.push_back(m_slots[m_freeIndices.back()]);
+            m_freeIndices.pop_back();
+        }
+
+        const size_t fresh = count - entities.size();
+        SirenAssert(
+            m_nextIndex + fresh <= EntityHandle::MAX_INDEX + 1,
+            "Cannot create more than {} entities",
+            EntityHandle::MAX_INDEX + 1
+        );
+        for (size_t i = 0; i < fresh; i++) { entities.emplace_back(m_nextIndex++, 0); }
+    }
 
-    m_entityToMask[e] = ComponentMask{ };
-    m_alive.push_back(e);
-    m_entityToIndex[e] = m_alive.size() - 1;
+    m_slots.reserve(m_nextIndex);
+    m_aliveIndex.reserve(m_nextIndex);
+    m_alive.reserve(m_alive.size() + count);
+    for (const EntityHandle entity : entities) { activate(entity); }
 
-    return e;
+    return entities;
 }
 
-void EntityManager::destroy(EntityHandle entity)
+EntityHandle EntityManager::reserve()
 {
-    if (!entity) { return; }
-
-    m_alive[m_entityToIndex[entity]]                  = m_alive.back();
-    m_entityToIndex[m_alive[m_entityToIndex[entity]]] = m_entityToIndex[entity];
+    std::lock_guard lock{ m_reserveMutex };
 
-    m_alive.pop_back();
+    if (!m_freeIndices.empty()) {
+        const u32 index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+        return m_slots[index];
+    }
 
-    m_entityToIndex.erase(entity);
-    m_entityToMask.erase(entity);
-    entity.invalidate();
+    SirenAssert(
+        m_nextIndex <= EntityHandle::MAX_INDEX,
+        "Cannot create more than {} entities",
+        EntityHandle::MAX_INDEX + 1
+    );
+    return EntityHandle{ m_nextIndex++, 0 };
 }
 
-Vector<EntityHandle> EntityManager::getWith(const ComponentMask components) const
+void EntityManager::activate(const EntityHandle entity)
 {
-    // This is probably the best solution with the current setup, but might have to rework whole ecs
-    // if things start slowing down
-    Vector<EntityHandle> entities{ };
-    for (const auto& [handle, mask] : m_entityToMask) {
-        if ((mask & components) == components) { entities.push_back(handle); }
+    const u32 index = entity.index();
+    // indices reserved by others in the meantime are filled in and activated later
+    while (m_slots.size() <= index) {
+        m_slots.emplace_back(static_cast<u32>(m_slots.size()), 0);
+        m_aliveIndex.push_back(NOT_ALIVE);
     }
-    return entities;
+
+    SirenAssert(
+        m_slots[index] == entity && m_aliveIndex[index] == NOT_ALIVE,
+        "Cannot activate entity {} that was not reserved",
+        entity
+    );
+
+    m_aliveIndex[index] = static_cast<u32>(m_alive.size());
+    m_alive.push_back(entity);
+}
+
+void EntityManager::destroy(const EntityHandle entity)
+{
+    if (!isAlive(entity)) { return; }
+
+    const u32 index    = entity.index();
+    const u32 position = m_aliveIndex[index];
+
+    m_alive[position]                       = m_alive.back();
+    m_aliveIndex[m_alive[position].index()] = position;
+    m_alive.pop_back();
+    m_aliveIndex[index] = NOT_ALIVE;
+
+    // bump the generation so that existing handles to this index become stale
+    const u32 generation =
+        entity.generation() == EntityHandle::MAX_GENERATION ? 0 : entity.generation() + 1;
+    m_slots[index] = EntityHandle{ index, generation };
+    m_freeIndices.push_back(index);
 }
 
 Vector<EntityHandle> EntityManager::getAll() const
@@ -5,13 +5,18 @@
 #include "EntityHandle.hpp"
 #include "utilities/spch.hpp"
 
+#include <mutex>
+
 
 namespace siren::core
 {
 
 /**
- * @brief Responsible for the creation, destruction and invalidation of EntityHandle's, as well as
- * managing the ComponentMask of each entity.
+ * @brief Responsible for the creation, destruction and invalidation of EntityHandle's. The
+ * ComponentMask of each entity is given by the @ref Archetype it is stored in.
+ *
+ * Entity indices are recycled after destruction, each reuse bumps the generation of the index so
+ * that handles to destroyed entities are detected as no longer alive.
  */
 class EntityManager
 {
@@ -22,39 +27,76 @@ public:
     /// @brief Creates a new entity.
     EntityHandle create();
 
-    /// @brief Invalidates the entity and erases its mask.
+    /// @brief Creates count new entities at once, growing the internal storage only once.
+    Vector<EntityHandle> createMany(size_t count);
+
+    /// @brief Reserves a handle for an entity that is created later via activate(). Reserved
+    /// handles are not alive and never handed out twice. May be called from any thread, as long
+    /// as no other function of this class is called concurrently.
+    EntityHandle reserve();
+
+    /// @brief Makes a reserved entity alive.
+    void activate(EntityHandle entity);
+
+    /// @brief Invalidates the entity. Does nothing if the entity is not alive.
     void destroy(EntityHandle entity);
 
-    /// @brief Returns all entities that have the component bits set in the mask
-    Vector<EntityHandle> getWith(ComponentMask components) const;
+    /// @brief Checks if the entity has been created and not yet destroyed.
+    bool isAlive(const EntityHandle entity) const
+    {
+        return entity && entity.index() < m_slots.size() && m_slots[entity.index()] == entity &&
+               m_aliveIndex[entity.index()] != NOT_ALIVE;
+    }
 
     /// @brief Returns all entities
     Vector<EntityHandle> getAll() const;
 
-    /// @brief Updates the given entities bitmask to correspond with its new component type.
-    template <typename T>
-    void add(const EntityHandle entity)
+    /// @brief A copy of the complete state of an EntityManager, see Scene::Snapshot().
+    struct Snapshot
     {
-        if (!entity) { return; }
-        if (!m_entityToMask.contains(entity)) { return; }
+        Vector<EntityHandle> slots;
+        Vector<u32> freeIndices;
+        u32 nextIndex;
+        Vector<EntityHandle> alive;
+        Vector<u32> aliveIndex;
+    };
 
-        m_entityToMask[entity].set(ComponentBitMap::getBitIndex<T>());
+    /// @brief Returns a copy of the current state.
+    Snapshot snapshot() const
+    {
+        return { m_slots, m_freeIndices, m_nextIndex, m_alive, m_aliveIndex };
     }
 
-    /// @brief Removes the given entities bitmask corresponding with the component type.
-    template <typename T>
-    void remove(EntityHandle& entity)
+    /// @brief Replaces the current state with the given snapshot.
+    void restore(const Snapshot& snapshot)
     {
-        if (!entity) { return; }
-        if (!m_entityToMask.contains(entity)) { return; }
-
-        m_entityToMask[entity].reset(ComponentBitMap::getBitIndex<T>());
+        m_slots       = snapshot.slots;
+        m_freeIndices = snapshot.freeIndices;
+        m_nextIndex   = snapshot.nextIndex;
+        m_alive       = snapshot.alive;
+        m_aliveIndex  = snapshot.aliveIndex;
     }
 
+    /// @brief Returns the amount of alive entities.
+    size_t size() const { return m_alive.size(); }
+
 private:
-    HashMap<EntityHandle, ComponentMask> m_entityToMask{ };
-    HashMap<EntityHandle, size_t> m_entityToIndex{ };
+    /// @brief Marks an index without an alive entity in m_aliveIndex.
+    static constexpr u32 NOT_ALIVE = ~0u;
+
+    /// @brief The current handle of each index. Holds the next generation for free indices.
+    Vector<EntityHandle> m_slots{ };
+    /// @brief Indices of destroyed entities ready for reuse.
+    Vector<u32> m_freeIndices{ };
+    /// @brief The next never used index. May be ahead of m_slots while reserved entities wait to
+    /// be activated.
+    u32 m_nextIndex = 0;
+    /// @brief Dense list of all alive entities.
     Vector<EntityHandle> m_alive{ };
+    /// @brief Position of each entity index in m_alive, NOT_ALIVE for free or reserved indices.
+    Vector<u32> m_aliveIndex{ };
+    /// @brief Guards the free list and m_nextIndex while reserving.
+    std::mutex m_reserveMutex{ };
 };
 
 } // namespace siren::ecs
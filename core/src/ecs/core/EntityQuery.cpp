@@ -0,0 +1,24 @@
+#include "EntityQuery.hpp"
+
+
+namespace siren::core
+{
+EntityQuery::EntityQuery(const ComponentMask mask) : m_mask(mask) { }
+
+bool EntityQuery::matches(const Archetype& archetype) const
+{
+    return (archetype.getMask() & m_mask) == m_mask;
+}
+
+void EntityQuery::tryAddArchetype(Archetype* archetype)
+{
+    if (matches(*archetype)) { m_archetypes.push_back(archetype); }
+}
+
+size_t EntityQuery::size() const
+{
+    size_t count = 0;
+    for (const auto* archetype : m_archetypes) { count += archetype->size(); }
+    return count;
+}
+} // namespace siren::core
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Archetype.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief A persistent query over all entities that have at least the components of a mask.
+ *
+ * Queries are owned and kept up to date by the @ref ComponentManager. Since entities with the same
+ * components share an @ref Archetype, a query only caches the matching archetypes, which only ever
+ * changes when a new archetype is created. Iterating a query is allocation free and only touches
+ * matching entities.
+ */
+class EntityQuery
+{
+public:
+    using ComponentMask = EntityManager::ComponentMask;
+
+    explicit EntityQuery(ComponentMask mask);
+
+    /// @brief Returns the mask of components required by this query.
+    ComponentMask getMask() const { return m_mask; }
+
+    /// @brief Checks if the entities of archetype match this query.
+    bool matches(const Archetype& archetype) const;
+
+    /// @brief Adds a newly created archetype to this query if it matches.
+    void tryAddArchetype(Archetype* archetype);
+
+    /// @brief Returns all matching archetypes.
+    const Vector<Archetype*>& getArchetypes() const { return m_archetypes; }
+
+    /// @brief Returns the amount of matching entities.
+    size_t size() const;
+
+    /// @brief Checks if no entity matches this query.
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief Forward iterator over the entities of all matching archetypes.
+     */
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = EntityHandle;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const EntityHandle*;
+        using reference         = const EntityHandle&;
+
+        Iterator() = default;
+
+        Iterator(const Vector<Archetype*>* archetypes, const size_t archetype)
+            : m_archetypes(archetypes), m_archetype(archetype)
+        {
+            skipEmpty();
+        }
+
+        reference operator*() const { return (*m_archetypes)[m_archetype]->getEntities()[m_row]; }
+
+        pointer operator->() const { return &**this; }
+
+        Iterator& operator++()
+        {
+            if (++m_row >= (*m_archetypes)[m_archetype]->size()) {
+                m_row = 0;
+                m_archetype++;
+                skipEmpty();
+            }
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const Iterator& o) const
+        {
+            return m_archetype == o.m_archetype && m_row == o.m_row;
+        }
+
+    private:
+        const Vector<Archetype*>* m_archetypes = nullptr;
+        size_t m_archetype                     = 0;
+        size_t m_row                           = 0;
+
+        /// @brief Advances to the next archetype that holds at least one entity.
+        void skipEmpty()
+        {
+            while (m_archetype < m_archetypes->size() && (*m_archetypes)[m_archetype]->size() == 0) {
+                m_archetype++;
+            }
+        }
+    };
+
+    Iterator begin() const { return Iterator{ &m_archetypes, 0 }; }
+    Iterator end() const { return Iterator{ &m_archetypes, m_archetypes.size() }; }
+
+private:
+    ComponentMask m_mask;
+    Vector<Archetype*> m_archetypes{ };
+};
+} // namespace siren::core
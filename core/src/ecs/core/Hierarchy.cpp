@@ -0,0 +1,128 @@
+#include "Hierarchy.hpp"
+
+
+namespace siren::core
+{
+void Hierarchy::setParent(const EntityHandle entity, const EntityHandle parent, const u32 tick)
+{
+    SirenAssert(entity && entity != parent, "Cannot parent entity {} to itself", entity);
+
+    u32 index = find(entity);
+    if (index == NONE) { index = addRoot(entity, tick); }
+    u32 parentIndex = NONE;
+    if (parent) {
+        parentIndex = find(parent);
+        if (parentIndex == NONE) { parentIndex = addRoot(parent, tick); }
+    }
+
+    const Node& node   = m_nodes[index];
+    const u32 count    = node.size;
+    const u32 oldDepth = node.depth;
+    if (node.parent == parent) { return; }
+    SirenAssert(
+        parentIndex == NONE || parentIndex < index || parentIndex >= index + count,
+        "Cannot parent entity {} to its own descendant {}",
+        entity,
+        parent
+    );
+
+    // the position the subtree is moved to, as if it had already been taken out of the array
+    u32 position = size() - count;
+    if (parentIndex != NONE) {
+        const u32 parentEnd = parentIndex + m_nodes[parentIndex].size;
+        position            = index < parentEnd ? parentEnd - count : parentEnd;
+    }
+
+    if (position != index) {
+        // move the subtree and rebuild the links of all nodes
+        m_scratch.assign(m_nodes.begin() + index, m_nodes.begin() + index + count);
+        m_scratch.front().parent      = parent;
+        m_scratch.front().changedTick = tick;
+        m_nodes.erase(m_nodes.begin() + index, m_nodes.begin() + index + count);
+        m_nodes.insert(m_nodes.begin() + position, m_scratch.begin(), m_scratch.end());
+        reindex();
+        return;
+    }
+
+    // the subtree already sits at the end of the new parent's subtree, only the links change
+    for (u32 i = m_nodes[index].parentIndex; i != NONE; i = m_nodes[i].parentIndex) {
+        m_nodes[i].size -= count;
+    }
+    for (u32 i = parentIndex; i != NONE; i = m_nodes[i].parentIndex) { m_nodes[i].size += count; }
+
+    const u32 newDepth = parentIndex == NONE ? 0 : m_nodes[parentIndex].depth + 1;
+    for (u32 i = index; i < index + count; i++) {
+        m_nodes[i].depth = m_nodes[i].depth - oldDepth + newDepth;
+    }
+
+    Node& moved       = m_nodes[index];
+    moved.parent      = parent;
+    moved.parentIndex = parentIndex;
+    moved.changedTick = tick;
+}
+
+void Hierarchy::remove(const std::span<const EntityHandle> entities, const u32 tick)
+{
+    // removed nodes are marked by a size of 0 until the array is compacted
+    bool removedAny = false;
+    for (const EntityHandle entity : entities) {
+        const u32 index = find(entity);
+        if (index == NONE) { continue; }
+        m_nodes[index].size       = 0;
+        m_indices[entity.index()] = NONE;
+        removedAny                = true;
+    }
+    if (!removedAny) { return; }
+
+    // parents precede their children, so the chain of removed ancestors is still intact here
+    for (Node& node : m_nodes) {
+        if (node.size == 0 || node.parentIndex == NONE || m_nodes[node.parentIndex].size != 0) {
+            continue;
+        }
+        u32 ancestor = node.parentIndex;
+        while (ancestor != NONE && m_nodes[ancestor].size == 0) {
+            ancestor = m_nodes[ancestor].parentIndex;
+        }
+        node.parent      = ancestor == NONE ? EntityHandle::invalid() : m_nodes[ancestor].entity;
+        node.changedTick = tick;
+    }
+
+    std::erase_if(m_nodes, [] (const Node& node) { return node.size == 0; });
+    reindex();
+}
+
+u32 Hierarchy::addRoot(const EntityHandle entity, const u32 tick)
+{
+    const u32 index = size();
+    m_nodes.push_back(
+        Node{
+            .entity      = entity,
+            .parent      = EntityHandle::invalid(),
+            .parentIndex = NONE,
+            .depth       = 0,
+            .size        = 1,
+            .changedTick = tick,
+        }
+    );
+    if (entity.index() >= m_indices.size()) { m_indices.resize(entity.index() + 1, NONE); }
+    m_indices[entity.index()] = index;
+    return index;
+}
+
+void Hierarchy::reindex()
+{
+    for (u32 i = 0; i < size(); i++) { m_indices[m_nodes[i].entity.index()] = i; }
+
+    for (Node& node : m_nodes) {
+        node.parentIndex = node.parent ? m_indices[node.parent.index()] : NONE;
+        node.depth       = node.parentIndex == NONE ? 0 : m_nodes[node.parentIndex].depth + 1;
+        node.size        = 1;
+    }
+
+    // children follow their parents, so walking backwards accumulates complete subtrees
+    for (u32 i = size(); i-- > 0;) {
+        const Node& node = m_nodes[i];
+        if (node.parentIndex != NONE) { m_nodes[node.parentIndex].size += node.size; }
+    }
+}
+} // namespace siren::core
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "EntityHandle.hpp"
+#include "utilities/spch.hpp"
+
+#include <span>
+
+
+namespace siren::core
+{
+/**
+ * @brief The parent/child relations of a scene, stored as a single flat array of nodes in
+ * depth-first order. Parents always precede their children and the subtree of a node is the
+ * contiguous range [index, index + size), so propagating data from parents to children and
+ * drawing the tree are linear scans that can skip whole subtrees.
+ *
+ * Only entities that have been given a parent, or have been added as a root, are part of the
+ * hierarchy. Structural edits are applied in place and keep the array ordered, the parent, depth
+ * and subtree size of each node are kept up to date so that no traversal ever has to allocate.
+ */
+class Hierarchy
+{
+public:
+    /// @brief Marks the absence of a node index.
+    static constexpr u32 NONE = ~0u;
+
+    struct Node
+    {
+        EntityHandle entity;
+        /// @brief The parent entity, invalid for roots.
+        EntityHandle parent;
+        /// @brief The index of the parent node, NONE for roots.
+        u32 parentIndex;
+        /// @brief The amount of ancestors.
+        u32 depth;
+        /// @brief The amount of nodes in this node's subtree, including itself.
+        u32 size;
+        /// @brief The change tick at which this node was added or last reparented.
+        u32 changedTick;
+    };
+
+    /// @brief Returns the amount of nodes.
+    u32 size() const { return static_cast<u32>(m_nodes.size()); }
+
+    /// @brief Checks if there are no nodes.
+    bool empty() const { return m_nodes.empty(); }
+
+    /// @brief Returns the node at index. Performs no bounds checking.
+    const Node& operator[](const u32 index) const { return m_nodes[index]; }
+
+    auto begin() const { return m_nodes.begin(); }
+    auto end() const { return m_nodes.end(); }
+
+    /// @brief Returns the index of entity's node, or NONE if entity is not part of the hierarchy.
+    u32 find(const EntityHandle entity) const
+    {
+        if (!entity || entity.index() >= m_indices.size()) { return NONE; }
+        const u32 index = m_indices[entity.index()];
+        return index != NONE && m_nodes[index].entity == entity ? index : NONE;
+    }
+
+    /// @brief Checks if entity is part of the hierarchy.
+    bool contains(const EntityHandle entity) const { return find(entity) != NONE; }
+
+    /// @brief Returns the parent of entity, or an invalid handle if it has none.
+    EntityHandle getParent(const EntityHandle entity) const
+    {
+        const u32 index = find(entity);
+        return index == NONE ? EntityHandle::invalid() : m_nodes[index].parent;
+    }
+
+    /// @brief Returns the index of the first child of the node at index, or NONE.
+    u32 getFirstChild(const u32 index) const
+    {
+        return m_nodes[index].size > 1 ? index + 1 : NONE;
+    }
+
+    /// @brief Returns the index of the next sibling of the node at index, or NONE.
+    u32 getNextSibling(const u32 index) const
+    {
+        const u32 next = index + m_nodes[index].size;
+        if (next >= size() || m_nodes[next].parentIndex != m_nodes[index].parentIndex) {
+            return NONE;
+        }
+        return next;
+    }
+
+    /**
+     * @brief Makes entity the last child of parent, or a root if parent is invalid, moving its
+     * whole subtree along. Entities not yet part of the hierarchy are added, this includes the
+     * parent, which is added as a root.
+     */
+    void setParent(EntityHandle entity, EntityHandle parent, u32 tick);
+
+    /// @brief Stamps every node with tick, as if all of them had just been reparented.
+    void markAllChanged(const u32 tick)
+    {
+        for (Node& node : m_nodes) { node.changedTick = tick; }
+    }
+
+    /// @brief Removes the given entities from the hierarchy. Their children are passed on to their
+    /// closest remaining ancestor. Entities that are not part of the hierarchy are skipped.
+    void remove(std::span<const EntityHandle> entities, u32 tick);
+
+private:
+    /// @brief All nodes in depth-first order.
+    Vector<Node> m_nodes{ };
+    /// @brief The node index of each entity, indexed by the entity's index.
+    Vector<u32> m_indices{ };
+    /// @brief Reused when moving subtrees.
+    Vector<Node> m_scratch{ };
+
+    /// @brief Appends entity as a root.
+    u32 addRoot(EntityHandle entity, u32 tick);
+    /// @brief Recomputes all indices, depths and subtree sizes from the node order and the parent
+    /// entities.
+    void reindex();
+};
+} // namespace siren::core
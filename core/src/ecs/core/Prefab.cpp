@@ -0,0 +1,54 @@
+#include "Prefab.hpp"
+
+
+namespace siren::core
+{
+Prefab::Prefab(const std::string& name) : Asset(name), m_components(CreateRef<Components>()) { }
+
+Prefab::Components::~Components()
+{
+    for (const auto& [info, component] : prototypes) {
+        info->destroy(component);
+        ::operator delete(component, std::align_val_t{ info->alignment });
+    }
+}
+
+Prefab::Components::Components(const Components& other)
+{
+    prototypes.reserve(other.prototypes.size());
+    for (const auto& [info, component] : other.prototypes) { info->copy(add(info), component); }
+}
+
+void* Prefab::Components::find(const size_t bitIndex) const
+{
+    for (const auto& [info, component] : prototypes) {
+        if (info->bitIndex == bitIndex) { return component; }
+    }
+    return nullptr;
+}
+
+void* Prefab::Components::add(const ComponentTypeInfo* info)
+{
+    void* component = ::operator new(info->size, std::align_val_t{ info->alignment });
+    prototypes.push_back({ info, component });
+    return component;
+}
+
+void Prefab::Components::remove(const size_t bitIndex)
+{
+    const auto it = std::ranges::find(prototypes, bitIndex, [] (const PrototypeComponent& p) {
+        return p.info->bitIndex;
+    });
+    if (it == prototypes.end()) { return; }
+
+    it->info->destroy(it->component);
+    ::operator delete(it->component, std::align_val_t{ it->info->alignment });
+    prototypes.erase(it);
+}
+
+Prefab::Components& Prefab::edit()
+{
+    if (m_components.use_count() > 1) { m_components = CreateRef<Components>(*m_components); }
+    return *m_components;
+}
+} // namespace siren::core
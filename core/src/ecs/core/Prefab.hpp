@@ -0,0 +1,105 @@
+#pragma once
+
+#include "ComponentManager.hpp"
+#include "assets/Asset.hpp"
+#include "ecs/components/IDComponent.hpp"
+#include "utilities/spch.hpp"
+
+#include <span>
+
+
+namespace siren::core
+{
+/**
+ * @brief A reusable set of components from which any number of entities can be created via
+ * Scene::Instantiate(). Each instance receives a copy of every component of the prefab, written
+ * into the scene's storage in bulk.
+ *
+ * The components of a prefab are copy-on-write. Copies of a prefab, e.g. to create a variation of
+ * it, share the same components until either of them is modified. Instances share the data
+ * referenced by handles, e.g. the mesh of a @ref MeshComponent, with the prefab.
+ */
+class Prefab final : public Asset
+{
+public:
+    ASSET_TYPE(AssetType::Prefab);
+
+    using PrototypeComponent = ComponentManager::PrototypeComponent;
+
+    explicit Prefab(const std::string& name);
+
+    ~Prefab() override = default;
+
+    /// @brief Sets the component T of this prefab, replacing an existing one.
+    template <typename T, typename... Args>
+        requires(ComponentType<T> && std::is_copy_constructible_v<T>)
+    T& Set(Args&&... args)
+    {
+        static_assert(!std::is_same_v<T, IDComponent>, "Each instance receives its own IDComponent");
+
+        const ComponentTypeInfo* info = ComponentTypeInfo::get<T>();
+        Components& components        = edit();
+        if (void* existing = components.find(info->bitIndex)) {
+            info->destroy(existing);
+            return *new(existing) T(std::forward<Args>(args)...);
+        }
+        return *new(components.add(info)) T(std::forward<Args>(args)...);
+    }
+
+    /// @brief Removes the component T from this prefab, if present.
+    template <typename T>
+        requires(ComponentType<T>)
+    void Remove()
+    {
+        if (!Has<T>()) { return; }
+        edit().remove(ComponentBitMap::getBitIndex<T>());
+    }
+
+    /// @brief Returns the component T of this prefab, or nullptr if it has none.
+    template <typename T>
+        requires(ComponentType<T>)
+    const T* Get() const
+    {
+        return static_cast<const T*>(m_components->find(ComponentBitMap::getBitIndex<T>()));
+    }
+
+    /// @brief Checks if this prefab has a component T.
+    template <typename T>
+        requires(ComponentType<T>)
+    bool Has() const
+    {
+        return Get<T>() != nullptr;
+    }
+
+    /// @brief Returns all components of this prefab.
+    std::span<const PrototypeComponent> GetComponents() const
+    {
+        return m_components->prototypes;
+    }
+
+private:
+    /// @brief The components of a prefab, shared between copies of it.
+    struct Components
+    {
+        Vector<PrototypeComponent> prototypes{ };
+
+        Components() = default;
+        ~Components();
+        Components(const Components& other);
+        Components& operator=(const Components&) = delete;
+
+        /// @brief Returns the component with the given bit index, or nullptr.
+        void* find(size_t bitIndex) const;
+        /// @brief Allocates an uninitialized component of the given type.
+        void* add(const ComponentTypeInfo* info);
+        /// @brief Destroys the component with the given bit index.
+        void remove(size_t bitIndex);
+    };
+
+    Ref<Components> m_components;
+
+    /// @brief Returns the components for modification, copying them first if they are shared with
+    /// another prefab.
+    Components& edit();
+};
+} // namespace siren::core
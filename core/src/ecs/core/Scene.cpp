@@ -1,32 +1,135 @@
 #include "Scene.hpp"
 
-#include <ecs/components/HierarchyComponent.hpp>
+#include "ecs/systems/SpatialIndexSystem.hpp"
 
 
 namespace siren::core
 {
 EntityHandle Scene::Create()
 {
+    if (isDeferring()) { return Commands().create(); }
+
     const auto entity = m_entityManager.create();
+    m_componentManager.emplace<IDComponent>(entity, utilities::UUID::create());
     trc("Created new entity {}", entity);
     return entity;
 }
 
 void Scene::destroy(const EntityHandle entity)
 {
-    if (!entity) {
+    if (isDeferring()) {
+        Commands().destroy(entity);
+        return;
+    }
+    if (!m_entityManager.isAlive(entity)) {
         dbg("Cannot destroy invalid entity");
         return;
     }
     trc("Destroyed entity {}", entity);
     m_entityManager.destroy(entity);
     m_componentManager.destroy(entity);
+    m_hierarchy.remove({ &entity, 1 }, m_componentManager.getChangeTick());
+    m_spatialIndex.remove(entity);
+}
+
+Vector<EntityHandle> Scene::Instantiate(const Prefab& prefab, const size_t count)
+{
+    if (isDeferring()) {
+        Vector<EntityHandle> entities;
+        entities.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            entities.push_back(Commands().create());
+            for (const auto& prototype : prefab.GetComponents()) {
+                Commands().emplace(entities.back(), prototype);
+            }
+        }
+        return entities;
+    }
+
+    Vector<EntityHandle> entities = m_entityManager.createMany(count);
+    m_componentManager.createMany<IDComponent>(
+        entities,
+        prefab.GetComponents(),
+        [] (EntityHandle, IDComponent* id) { new(id) IDComponent(utilities::UUID::create()); }
+    );
+    trc("Instantiated {} entities from prefab {}", count, prefab.GetName());
+    return entities;
+}
+
+void Scene::DestroyMany(const std::span<const EntityHandle> entities)
+{
+    if (isDeferring()) {
+        for (const EntityHandle entity : entities) { Commands().destroy(entity); }
+        return;
+    }
+
+    size_t destroyed = 0;
+    for (const EntityHandle entity : entities) {
+        if (!m_entityManager.isAlive(entity)) { continue; }
+        m_entityManager.destroy(entity);
+        m_componentManager.destroy(entity);
+        m_spatialIndex.remove(entity);
+        destroyed++;
+    }
+    m_hierarchy.remove(entities, m_componentManager.getChangeTick());
+    trc("Destroyed {} entities", destroyed);
+}
+
+void Scene::SetParent(const EntityHandle entity, const EntityHandle parent)
+{
+    SirenAssert(m_iterationDepth.load() == 0, "Cannot change the hierarchy while iterating");
+    SirenAssert(m_entityManager.isAlive(entity), "Cannot parent non existing entity {}", entity);
+    SirenAssert(
+        !parent || m_entityManager.isAlive(parent),
+        "Cannot parent entity {} to non existing entity {}",
+        entity,
+        parent
+    );
+
+    m_hierarchy.setParent(entity, parent, m_componentManager.getChangeTick());
+}
+
+SceneSnapshot Scene::Snapshot() const
+{
+    SirenAssert(!isDeferring() && !m_isUpdating, "Cannot snapshot a scene while it is updated");
+
+    return SceneSnapshot{
+        m_entityManager.snapshot(),
+        m_componentManager.snapshot(),
+        CreateOwn<SingletonManager>(m_singletonManager),
+        m_hierarchy,
+    };
+}
+
+void Scene::Restore(const SceneSnapshot& snapshot)
+{
+    SirenAssert(!isDeferring() && !m_isUpdating, "Cannot restore a scene while it is updated");
+
+    {
+        std::lock_guard lock{ m_commandBufferMutex };
+        for (const auto& commands : m_commandBuffers) { commands->reset(); }
+    }
+
+    m_entityManager.restore(snapshot.m_entities);
+    m_componentManager.restore(snapshot.m_components);
+    m_singletonManager.restore(*snapshot.m_singletons);
+    m_hierarchy = snapshot.m_hierarchy;
+    m_hierarchy.markAllChanged(m_componentManager.getChangeTick());
+    // all restored components count as added, the SpatialIndexSystem rebuilds the index
+    m_spatialIndex.clear();
+    trc("Restored {} entities", snapshot.size());
 }
 
 void Scene::onUpdate(const float delta)
 {
     if (m_isPaused) { return; }
-    m_systemManager.onUpdate(delta, *this);
+
+    m_isUpdating = true;
+    for (u32 phase = 0; phase < SystemPhaseMax; phase++) {
+        m_systemManager.onUpdate(static_cast<SystemPhase>(phase), delta, *this);
+        flushCommands();
+    }
+    m_isUpdating = false;
 }
 
 void Scene::onRender()
@@ -52,4 +155,36 @@ void Scene::resume()
     }
 }
 
+void Scene::onComponentsRemoved(const EntityHandle entity)
+{
+    if (m_spatialIndex.contains(entity) && !SpatialIndexSystem::IsIndexed(*this, entity)) {
+        m_spatialIndex.remove(entity);
+    }
+}
+
+CommandBuffer& Scene::Commands()
+{
+    // most calls hit the cache, only the first call of a thread has to take the lock
+    thread_local u64 t_sceneId             = 0;
+    thread_local CommandBuffer* t_commands = nullptr;
+    if (t_sceneId == m_id) { return *t_commands; }
+
+    std::lock_guard lock{ m_commandBufferMutex };
+    CommandBuffer*& commands = m_threadCommandBuffers[std::this_thread::get_id()];
+    if (!commands) {
+        m_commandBuffers.push_back(CreateOwn<CommandBuffer>(*this));
+        commands = m_commandBuffers.back().get();
+    }
+
+    t_sceneId  = m_id;
+    t_commands = commands;
+    return *commands;
+}
+
+void Scene::flushCommands()
+{
+    assertNotOnWorker();
+    for (const auto& commands : m_commandBuffers) { commands->flush(); }
+}
+
 } // namespace siren::ecs
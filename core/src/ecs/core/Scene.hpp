@@ -1,10 +1,17 @@
 #pragma once
 
+#include "CommandBuffer.hpp"
 #include "ComponentManager.hpp"
+#include "ComponentView.hpp"
+#include "Hierarchy.hpp"
+#include "Prefab.hpp"
+#include "SceneSnapshot.hpp"
 #include "SingletonManager.hpp"
+#include "SpatialIndex.hpp"
 #include "SystemManager.hpp"
 #include "entt.hpp"
 
+#include "ecs/components/IDComponent.hpp"
 #include "ecs/core/ComponentBitMap.hpp"
 #include "ecs/core/EntityManager.hpp"
 
@@ -28,12 +35,65 @@ public:
     Scene()  = default;
     ~Scene() = default;
 
-    /// @brief Create and return an EntityHandle
+    /// @brief Create and return an EntityHandle. While the scene is updated or iterated the
+    /// entity is only reserved, its components are added when the commands are flushed.
     EntityHandle Create();
 
-    /// @brief Destroys the given entity.
+    /// @brief Destroys the given entity. While the scene is updated or iterated the entity is
+    /// destroyed when the commands are flushed.
     void destroy(EntityHandle entity);
 
+    /**
+     * @brief Creates count entities, each receiving a copy of every given prototype component.
+     * Storage for all entities is reserved up front and the components are written in a single
+     * pass, which is much cheaper than count calls to Create() and Emplace().
+     */
+    template <typename... Ts>
+        requires((ComponentType<Ts> && std::is_copy_constructible_v<Ts>) && ...)
+    Vector<EntityHandle> CreateMany(const size_t count, const Ts&... prototypes)
+    {
+        static_assert(
+            (!std::is_same_v<Ts, IDComponent> && ...),
+            "Each entity receives its own IDComponent"
+        );
+
+        if (isDeferring()) {
+            Vector<EntityHandle> entities;
+            entities.reserve(count);
+            for (size_t i = 0; i < count; i++) {
+                entities.push_back(Commands().create());
+                (Commands().emplace<Ts>(entities.back(), prototypes), ...);
+            }
+            return entities;
+        }
+
+        Vector<EntityHandle> entities = m_entityManager.createMany(count);
+        m_componentManager.createMany<IDComponent, Ts...>(
+            entities,
+            [&prototypes...] (EntityHandle, IDComponent* id, Ts*... components) {
+                new(id) IDComponent(utilities::UUID::create());
+                (new(components) Ts(prototypes), ...);
+            }
+        );
+        trc("Created {} entities", count);
+        return entities;
+    }
+
+    /// @brief Creates count entities from prefab, each receiving a copy of all of its components.
+    /// Like CreateMany(), storage is reserved up front and each component type is written in a
+    /// single pass.
+    Vector<EntityHandle> Instantiate(const Prefab& prefab, size_t count = 1);
+
+    /// @brief Destroys all given entities. Entities that are not alive are skipped.
+    void DestroyMany(std::span<const EntityHandle> entities);
+
+    /// @brief Checks if the entity exists, i.e. was created and has not been destroyed yet. Stale
+    /// handles to destroyed entities are never alive, even if their index has been reused.
+    bool IsAlive(const EntityHandle entity) const
+    {
+        return m_entityManager.isAlive(entity);
+    }
+
     /// @brief Returns all alive entities
     Vector<EntityHandle> getAll() const
     {
@@ -42,40 +102,113 @@ public:
 
     /// @brief Default creates a component of type T and assigns it to the given entity. If the
     /// component already exists on this entity, nothing is changed and a reference to the existing
-    /// component is returned.
+    /// component is returned. While the scene is updated or iterated the change is deferred, see
+    /// Commands().
     template <typename T, typename... Args>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     T& Emplace(const EntityHandle entity, Args&&... args)
     {
-        SirenAssert(entity, "Attempting to register a component to a non existing entity");
+        if (isDeferring()) { return Commands().emplace<T>(entity, std::forward<Args>(args)...); }
+        return EmplaceImmediate<T>(entity, std::forward<Args>(args)...);
+    }
+
+    /// @brief Like Emplace(), but always applies the change right away, also while the systems
+    /// are updated. Only exclusive systems may use this, and never from within Each() or
+    /// ParallelEach().
+    template <typename T, typename... Args>
+        requires(ComponentType<T>)
+    T& EmplaceImmediate(const EntityHandle entity, Args&&... args)
+    {
+        SirenAssert(m_iterationDepth.load() == 0, "Cannot add components while iterating");
+        assertNotOnWorker();
+        SirenAssert(
+            m_entityManager.isAlive(entity),
+            "Attempting to register a component to a non existing entity"
+        );
 
-        m_entityManager.add<T>(entity);
         trc("Added {} to entity {}", entt::type_name<T>().value(), entity);
         return m_componentManager.emplace<T>(entity, std::forward<Args>(args)...);
     }
 
-    /// @brief Deletes the relation between the entity and the component of type T.
+    /// @brief Deletes the relation between the entity and the component of type T. While the scene
+    /// is updated or iterated the change is deferred, see Commands().
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     void remove(EntityHandle entity)
     {
-        if (!entity) {
+        if (isDeferring()) {
+            Commands().remove<T>(entity);
+            return;
+        }
+        if (!m_entityManager.isAlive(entity)) {
             dbg("Attempting to unregister a component from a non existing entity");
             return;
         }
 
         trc("Removed {} from entity {}", entt::type_name<T>().value(), entity);
-        m_entityManager.remove<T>(entity);
         m_componentManager.remove<T>(entity);
+        onComponentsRemoved(entity);
     }
 
     template <typename T>
         requires(std::derived_from<T, NativeScript>)
     void bind(const EntityHandle entity);
 
+    /// @brief Makes entity the last child of parent, or a root of the hierarchy if parent is
+    /// invalid. Entities become part of the hierarchy on their first call, destroyed entities
+    /// leave it and pass their children on to their own parent.
+    void SetParent(EntityHandle entity, EntityHandle parent = EntityHandle::invalid());
+
+    /// @brief Returns the parent of entity, or an invalid handle if it has none.
+    EntityHandle GetParent(const EntityHandle entity) const
+    {
+        return m_hierarchy.getParent(entity);
+    }
+
+    /// @brief Returns the flat, depth-first ordered parent/child relations of this scene.
+    const Hierarchy& GetHierarchy() const { return m_hierarchy; }
+
+    /// @brief Returns the index of the world space bounds of this scene's entities. It is kept up
+    /// to date by the @ref SpatialIndexSystem, destroyed entities are removed right away.
+    SpatialIndex& GetSpatialIndex() { return m_spatialIndex; }
+    const SpatialIndex& GetSpatialIndex() const { return m_spatialIndex; }
+
+    /// @brief Calls fn with each entity whose world space bounds intersect box, as of the last
+    /// update of the @ref SpatialIndexSystem.
+    template <typename Fn>
+    void QueryBox(const AABB& box, Fn&& fn) const
+    {
+        m_spatialIndex.queryBox(box, std::forward<Fn>(fn));
+    }
+
+    /// @brief Calls fn with each entity whose world space bounds intersect sphere, as of the last
+    /// update of the @ref SpatialIndexSystem.
+    template <typename Fn>
+    void QuerySphere(const BoundingSphere& sphere, Fn&& fn) const
+    {
+        m_spatialIndex.querySphere(sphere, std::forward<Fn>(fn));
+    }
+
+    /// @brief Calls fn with each entity whose world space bounds intersect frustum, as of the last
+    /// update of the @ref SpatialIndexSystem.
+    template <typename Fn>
+    void QueryFrustum(const Frustum& frustum, Fn&& fn) const
+    {
+        m_spatialIndex.queryFrustum(frustum, std::forward<Fn>(fn));
+    }
+
+    /// @brief Returns the entity whose world space bounds ray enters first, e.g. for picking.
+    Maybe<SpatialIndex::RaycastHit> Raycast(
+        const Ray& ray,
+        const float maxDistance = std::numeric_limits<float>::max()
+    ) const
+    {
+        return m_spatialIndex.raycast(ray, maxDistance);
+    }
+
     /// @brief Default constructs a singleton component. These are unique in the whole scene
     template <typename T, typename... Args>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     T& emplaceSingleton(Args&&... args)
     {
         trc("Adding singleton {}", entt::type_name<T>().value());
@@ -84,7 +217,7 @@ public:
 
     /// @brief Removes the singleton component T if it is present, otherwise nothing happens
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     void removeSingleton()
     {
         trc("Removing singleton {}", entt::type_name<T>().value());
@@ -94,7 +227,7 @@ public:
     /// @brief Returns a reference to the singleton of type T. Requires that the singleton exists so
     /// make sure it does!
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     T& GetSingleton() const
     {
         return static_cast<T&>(m_singletonManager.getSingleton<T>());
@@ -102,7 +235,7 @@ public:
 
     /// @brief Returns a raw pointer to the singleton of type T.
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     T* GetSingletonSafe() const
     {
         return m_singletonManager.getSingletonSafe<T>();
@@ -110,7 +243,7 @@ public:
 
     /// @brief An unsafe get of the component of type T associated with the given entity
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     T& get(const EntityHandle entity)
     {
         SirenAssert(entity, "Performing unsafe get on a non existing entity.");
@@ -119,7 +252,7 @@ public:
 
     /// @brief An unsafe get of the component of type T associated with the given entity
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     T& get(const EntityHandle entity) const
     {
         SirenAssert(entity, "Performing unsafe get on a non existing entity.");
@@ -128,10 +261,10 @@ public:
 
     /// @brief A safe get of the component of type T associated with the given entity
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     T* GetSafe(const EntityHandle entity) const
     {
-        if (!entity) { return nullptr; }
+        if (!m_entityManager.isAlive(entity)) { return nullptr; }
         return m_componentManager.GetSafe<T>(entity);
     }
 
@@ -139,13 +272,139 @@ public:
     template <typename... Args>
     Vector<EntityHandle> GetWith() const
     {
-        EntityManager::ComponentMask requiredComponents{ };
-        // fold expression, applies the LHS expression to each T in Args
-        (requiredComponents.set(ComponentBitMap::getBitIndex<Args>()), ...);
+        if constexpr (((getComponentStorage<Args>() != ComponentStorage::ARCHETYPE) || ...)) {
+            Vector<EntityHandle> entities;
+            View<const Args...>().each(
+                [&entities] (const EntityHandle entity, const Args&...) {
+                    entities.push_back(entity);
+                }
+            );
+            return entities;
+        } else {
+            const EntityQuery& query = Query<Args...>();
+            return { query.begin(), query.end() };
+        }
+    }
+
+    /// @brief Returns the persistent query of all entities that have the given components. The
+    /// query is kept up to date by the scene, so it may be stored and iterated every frame without
+    /// any allocations. Queries only match archetypes, use View() for sparse and tag components.
+    template <typename... Args>
+    const EntityQuery& Query() const
+    {
+        static_assert(
+            ((getComponentStorage<Args>() == ComponentStorage::ARCHETYPE) && ...),
+            "Queries cannot match sparse or tag components, use View() instead"
+        );
+        return getArchetypeQuery<Args...>();
+    }
 
-        return m_entityManager.getWith(requiredComponents);
+    /// @brief Returns a view over all entities that have the given components. Iterating the view
+    /// yields (EntityHandle, Ts&...) tuples referencing the components in place. Non-const
+    /// components are marked as changed when visited.
+    template <typename... Ts>
+    ComponentView<Ts...> View() const
+    {
+        return ComponentView<Ts...>{
+            m_componentManager,
+            getArchetypeQuery<Ts...>(),
+            m_componentManager.getChangeTick()
+        };
     }
 
+    /**
+     * @brief Like View(), but only visits entities whose first component T was added or mutably
+     * accessed after sinceTick. A system typically iterates Changed<T>(m_lastTick) and then sets
+     * m_lastTick = AdvanceChangeTick(), so it sees every change exactly once, but not the changes
+     * it made itself.
+     */
+    template <typename T, typename... Ts>
+    ComponentView<T, Ts...> Changed(const u32 sinceTick) const
+    {
+        static_assert(
+            getComponentStorage<T>() == ComponentStorage::ARCHETYPE,
+            "Change detection requires the first component to be archetype stored"
+        );
+        return ComponentView<T, Ts...>{
+            m_componentManager,
+            getArchetypeQuery<T, Ts...>(),
+            m_componentManager.getChangeTick(),
+            ComponentView<T, Ts...>::Filter::CHANGED,
+            sinceTick
+        };
+    }
+
+    /// @brief Like View(), but only visits entities whose first component T was added after
+    /// sinceTick.
+    template <typename T, typename... Ts>
+    ComponentView<T, Ts...> Added(const u32 sinceTick) const
+    {
+        static_assert(
+            getComponentStorage<T>() == ComponentStorage::ARCHETYPE,
+            "Change detection requires the first component to be archetype stored"
+        );
+        return ComponentView<T, Ts...>{
+            m_componentManager,
+            getArchetypeQuery<T, Ts...>(),
+            m_componentManager.getChangeTick(),
+            ComponentView<T, Ts...>::Filter::ADDED,
+            sinceTick
+        };
+    }
+
+    /// @brief Returns the current change tick. Added and mutably accessed components are stamped
+    /// with it.
+    u32 GetChangeTick() const { return m_componentManager.getChangeTick(); }
+
+    /// @brief Advances the change tick and returns its previous value, to be passed to Changed()
+    /// and Added() later on.
+    u32 AdvanceChangeTick() { return m_componentManager.advanceChangeTick(); }
+
+    /**
+     * @brief Calls fn with each entity that has the given components and references to these
+     * components. fn may take (EntityHandle, Ts&...) or just (Ts&...).
+     *
+     * Structural changes made from within fn are deferred like those made during ParallelEach(),
+     * so the storage being iterated is never moved. They are applied once the outermost iteration
+     * returns, or at the end of the current phase when called from a system.
+     */
+    template <typename... Ts, typename Fn>
+    void Each(Fn&& fn)
+    {
+        m_iterationDepth++;
+        View<Ts...>().each(std::forward<Fn>(fn));
+        if (--m_iterationDepth == 0 && !m_isUpdating) { flushCommands(); }
+    }
+
+    /**
+     * @brief Like Each(), but processes the entities concurrently on the engine @ref ThreadPool in
+     * cache line aligned chunks. fn must be safe to call concurrently for different entities.
+     *
+     * Structural changes made during the iteration, i.e. Create(), Emplace(), remove() and
+     * destroy(), are recorded into the calling thread's @ref CommandBuffer. They are applied once
+     * all chunks have been processed, or at the end of the current phase when called from a
+     * system. A deferred Emplace() returns a reference to a staged component which stays valid
+     * until then.
+     */
+    template <typename... Ts, typename Fn>
+    void ParallelEach(Fn&& fn)
+    {
+        m_iterationDepth++;
+        View<Ts...>().parallelEach(ThreadPool::Get(), std::forward<Fn>(fn));
+        if (--m_iterationDepth == 0 && !m_isUpdating) { flushCommands(); }
+    }
+
+    /**
+     * @brief Returns the @ref CommandBuffer of the calling thread. Recording into it is always
+     * safe, even while the scene is iterated or updated concurrently. Recorded changes are applied
+     * at the end of each phase in onUpdate(), or by calling flushCommands().
+     */
+    CommandBuffer& Commands();
+
+    /// @brief Applies the changes recorded in the command buffers of all threads. Must only be
+    /// called while the scene is not iterated or updated from other threads.
+    void flushCommands();
+
     /// @brief Registers and starts the system T. The onReady() function of T will also be called
     template <typename T>
         requires(std::is_base_of_v<System, T>)
@@ -167,7 +426,7 @@ public:
     template <typename T>
     bool hasComponent(const EntityHandle entity) const
     {
-        return m_componentManager.hasComponent<T>(entity);
+        return m_entityManager.isAlive(entity) && m_componentManager.hasComponent<T>(entity);
     }
 
     /// @brief Calls the onUpdate method of all active systems.
@@ -176,6 +435,22 @@ public:
     /// @brief Calls the onDraw method of all active systems.
     void onRender();
 
+    /**
+     * @brief Copies all entities, components, singletons and the hierarchy, e.g. to restore the
+     * edited scene after play mode. Must not be called while the scene is iterated or updated,
+     * commands which have not been flushed yet are not captured. See @ref SceneSnapshot for how
+     * references between entities are restored.
+     */
+    SceneSnapshot Snapshot() const;
+
+    /**
+     * @brief Replaces all entities, components, singletons and the hierarchy with those of the
+     * snapshot, which may be restored any number of times. Pending commands are discarded. Every
+     * restored component counts as added, so change detection picks up all of them. Must not be
+     * called while the scene is iterated or updated.
+     */
+    void Restore(const SceneSnapshot& snapshot);
+
     /// @brief Pauses the scene from updating. This means any update calls will have no effect.
     void pause();
     /// @brief Resumes the scene.
@@ -186,7 +461,57 @@ private:
     ComponentManager m_componentManager{ };
     SystemManager m_systemManager{ };
     SingletonManager m_singletonManager{ };
+    Hierarchy m_hierarchy{ };
+    SpatialIndex m_spatialIndex{ };
 
     bool m_isPaused{ false };
+    /// @brief Set while the systems are updated, changes are then flushed at phase boundaries.
+    bool m_isUpdating{ false };
+
+    /// @brief The amount of Each() and ParallelEach() calls currently running.
+    std::atomic<u32> m_iterationDepth{ 0 };
+
+    /// @brief Unique id of this scene, used to cache the command buffer of each thread.
+    const u64 m_id{ s_nextId++ };
+    static inline std::atomic<u64> s_nextId{ 1 };
+    /// @brief The command buffer of each thread, in creation order so that flushing is
+    /// deterministic.
+    Vector<Own<CommandBuffer>> m_commandBuffers{ };
+    HashMap<std::thread::id, CommandBuffer*> m_threadCommandBuffers{ };
+    std::mutex m_commandBufferMutex{ };
+
+    friend class CommandBuffer;
+
+    /// @brief Checks if structural changes must currently be recorded instead of applied, i.e.
+    /// while the systems are updated or the scene is iterated.
+    bool isDeferring() const { return m_isUpdating || m_iterationDepth.load() > 0; }
+
+    /// @brief Drops entity from the spatial index once it lost its world transform or bounds.
+    void onComponentsRemoved(EntityHandle entity);
+
+    /// @brief Asserts that the storage is not changed from a pool worker, i.e. from a non
+    /// exclusive system, while the systems are updated.
+    void assertNotOnWorker() const
+    {
+        SirenAssert(
+            !m_isUpdating || !ThreadPool::Get().isWorkerThread(),
+            "Only exclusive systems may change the scene while it is updated"
+        );
+    }
+
+    /// @brief Returns the query matching the archetype stored components among Ts, sparse and tag
+    /// components are skipped.
+    template <typename... Ts>
+    const EntityQuery& getArchetypeQuery() const
+    {
+        EntityManager::ComponentMask requiredComponents{ };
+        // fold expression, applies the LHS expression to each T in Ts
+        ((getComponentStorage<Ts>() == ComponentStorage::ARCHETYPE
+              ? void(requiredComponents.set(ComponentBitMap::getBitIndex<Ts>()))
+              : void()),
+         ...);
+
+        return m_componentManager.query(requiredComponents);
+    }
 };
 } // namespace siren::ecs
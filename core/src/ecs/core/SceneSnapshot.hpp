@@ -0,0 +1,46 @@
+#pragma once
+
+#include "ComponentManager.hpp"
+#include "EntityManager.hpp"
+#include "Hierarchy.hpp"
+#include "SingletonManager.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief A copy of the entities, components, singletons and hierarchy of a @ref Scene, taken with
+ * Scene::Snapshot() and applied with Scene::Restore(). Components are copied as whole columns
+ * rather than entity by entity, which makes this cheap enough to enter and exit play mode with.
+ * Systems and pending commands are not part of a snapshot.
+ *
+ * Entity handles are restored as they were, so components and singletons referring to other
+ * entities must do so by @ref EntityHandle. Pointers into component storage are copied as is and
+ * do not follow the restored components, which live in new storage.
+ */
+class SceneSnapshot
+{
+public:
+    /// @brief Returns the amount of entities captured.
+    size_t size() const { return m_entities.alive.size(); }
+
+private:
+    SceneSnapshot(
+        EntityManager::Snapshot entities,
+        ComponentManager::Snapshot components,
+        Own<SingletonManager> singletons,
+        Hierarchy hierarchy
+    ) : m_entities(std::move(entities)),
+        m_components(std::move(components)),
+        m_singletons(std::move(singletons)),
+        m_hierarchy(std::move(hierarchy)) { }
+
+    EntityManager::Snapshot m_entities;
+    ComponentManager::Snapshot m_components;
+    Own<SingletonManager> m_singletons;
+    Hierarchy m_hierarchy;
+
+    friend class Scene;
+};
+} // namespace siren::core
@@ -0,0 +1,62 @@
+#include "SingletonManager.hpp"
+
+
+namespace siren::core
+{
+SingletonManager::~SingletonManager()
+{
+    for (const Singleton& singleton : m_singletons) {
+        if (singleton.data) { release(singleton); }
+    }
+}
+
+SingletonManager::SingletonManager(const SingletonManager& other)
+{
+    for (size_t bitIndex = 0; bitIndex < MAX_COMPONENTS; bitIndex++) {
+        const Singleton& source = other.m_singletons[bitIndex];
+        if (!source.data) { continue; }
+        if (!source.info->copy) {
+            wrn("Cannot copy singleton with bit index {}, it is not copy constructible", bitIndex);
+            continue;
+        }
+        void* data = allocate(source.info);
+        source.info->copy(data, source.data);
+        m_singletons[bitIndex] = Singleton{ source.info, data };
+    }
+}
+
+void SingletonManager::restore(const SingletonManager& snapshot)
+{
+    for (size_t bitIndex = 0; bitIndex < MAX_COMPONENTS; bitIndex++) {
+        Singleton& singleton    = m_singletons[bitIndex];
+        const Singleton& source = snapshot.m_singletons[bitIndex];
+
+        if (!source.data) {
+            // singletons which could not have been captured are kept
+            if (singleton.data && singleton.info->copy) {
+                release(singleton);
+                singleton = Singleton{ };
+            }
+            continue;
+        }
+
+        if (singleton.data) {
+            source.info->destroy(singleton.data);
+        } else {
+            singleton = Singleton{ source.info, allocate(source.info) };
+        }
+        source.info->copy(singleton.data, source.data);
+    }
+}
+
+void* SingletonManager::allocate(const ComponentTypeInfo* info)
+{
+    return ::operator new(info->size, std::align_val_t{ info->alignment });
+}
+
+void SingletonManager::release(const Singleton& singleton)
+{
+    singleton.info->destroy(singleton.data);
+    ::operator delete(singleton.data, std::align_val_t{ singleton.info->alignment });
+}
+} // namespace siren::core
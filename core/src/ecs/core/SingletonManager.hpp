@@ -1,7 +1,7 @@
 #pragma once
 
 #include "ecs/core/Component.hpp"
-#include "ecs/core/ComponentBitMap.hpp"
+#include "ecs/core/ComponentColumn.hpp"
 #include "utilities/spch.hpp"
 
 
@@ -9,56 +9,87 @@ namespace siren::core
 {
 
 /// @brief Responsible for managing the singleton components. Singleton components are globally
-/// unique in the scene, and are not bound to any entity.
+/// unique in the scene, and are not bound to any entity. Singletons live in a flat table indexed by
+/// their ComponentBitMap index, each in its own allocation so that its address never changes.
 class SingletonManager
 {
 public:
+    SingletonManager() = default;
+    ~SingletonManager();
+
+    /// @brief Copies all singletons whose type is copy constructible, see Scene::Snapshot().
+    SingletonManager(const SingletonManager& other);
+    SingletonManager& operator=(const SingletonManager&) = delete;
+
     /// @brief Default constructs a singleton of type T either with default args or with the
     /// provided args
     template <typename T, typename... Args>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     T& emplaceSingleton(Args&&... args)
     {
-        const size_t componentIndex = ComponentBitMap::getBitIndex<T>();
-        if (!m_singletons.contains(componentIndex)) {
-            m_singletons.emplace(componentIndex, CreateOwn<T>(std::forward<Args>(args)...));
+        const ComponentTypeInfo* info = ComponentTypeInfo::get<T>();
+        Singleton& singleton          = m_singletons[info->bitIndex];
+        if (!singleton.data) {
+            void* data = allocate(info);
+            new(data) T(std::forward<Args>(args)...);
+            singleton = Singleton{ info, data };
         }
-        return *static_cast<T*>(m_singletons[componentIndex].get());
+        return *static_cast<T*>(singleton.data);
     }
 
     /// @brief Removes the singleton of type T if it exists
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     void removeSingleton()
     {
-        const size_t componentIndex = ComponentBitMap::getBitIndex<T>();
-        if (!m_singletons.contains(componentIndex)) { return; }
-        m_singletons.erase(componentIndex);
+        Singleton& singleton = m_singletons[ComponentBitMap::getBitIndex<T>()];
+        if (!singleton.data) { return; }
+        release(singleton);
+        singleton = Singleton{ };
     }
 
     /// @brief Returns a reference to the singleton of type T. Requires that the singleton does
     /// exist, so be sure to  make sure it does!
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     T& getSingleton() const
     {
-        const size_t componentIndex = ComponentBitMap::getBitIndex<T>();
-        SirenAssert(m_singletons.contains(componentIndex), "Cannot get non existent singleton");
-        return *static_cast<T*>(m_singletons[componentIndex].get());
+        void* data = m_singletons[ComponentBitMap::getBitIndex<T>()].data;
+        SirenAssert(data, "Cannot get non existent singleton");
+        return *static_cast<T*>(data);
     }
 
     /// @brief Returns a raw pointer to the singleton of type T.
     template <typename T>
-        requires(std::is_base_of_v<Component, T>)
+        requires(ComponentType<T>)
     T* getSingletonSafe() const
     {
-        const size_t componentIndex = ComponentBitMap::getBitIndex<T>();
-        if (!m_singletons.contains(componentIndex)) { return nullptr; }
-        return static_cast<T*>(m_singletons[componentIndex].get());
+        return static_cast<T*>(m_singletons[ComponentBitMap::getBitIndex<T>()].data);
     }
 
+    /**
+     * @brief Replaces all copyable singletons with copies of the snapshot's. Singletons that exist
+     * in both are destroyed and copy constructed in place, so references to them stay valid.
+     * Singletons which are not copyable are left untouched.
+     */
+    void restore(const SingletonManager& snapshot);
+
 private:
-    mutable HashMap<size_t, Own<Component>> m_singletons{ };
+    /// @brief A singleton of any component type, destroyed and freed through its type info.
+    struct Singleton
+    {
+        const ComponentTypeInfo* info = nullptr;
+        /// @brief The singleton, nullptr if the slot is empty.
+        void* data = nullptr;
+    };
+
+    /// @brief The singleton of each component type, indexed by bit index.
+    Array<Singleton, MAX_COMPONENTS> m_singletons{ };
+
+    /// @brief Allocates uninitialized storage for a singleton of the given type.
+    static void* allocate(const ComponentTypeInfo* info);
+    /// @brief Destroys and frees the singleton.
+    static void release(const Singleton& singleton);
 };
 
 } // namespace siren::ecs
@@ -0,0 +1,46 @@
+#include "SparseSet.hpp"
+
+
+namespace siren::core
+{
+u32 SparseSet::insertUninitialized(const EntityHandle entity)
+{
+    SirenAssert(!contains(entity), "Entity {} already has a component in this set", entity);
+
+    if (entity.index() >= m_rows.size()) { m_rows.resize(entity.index() + 1, NONE); }
+
+    const u32 row = static_cast<u32>(m_entities.size());
+    m_entities.push_back(entity);
+    m_components.pushUninitialized();
+    m_rows[entity.index()] = row;
+    return row;
+}
+
+void SparseSet::erase(const EntityHandle entity)
+{
+    const u32 row = find(entity);
+    if (row == NONE) { return; }
+
+    m_components.erase(row);
+
+    const EntityHandle last = m_entities.back();
+    m_entities[row]         = last;
+    m_entities.pop_back();
+    m_rows[last.index()]   = row;
+    m_rows[entity.index()] = NONE;
+}
+void SparseSet::clear()
+{
+    m_components.clear();
+    m_entities.clear();
+    m_rows.clear();
+}
+
+void SparseSet::assign(const SparseSet& source)
+{
+    clear();
+    m_components.append(source.m_components);
+    m_entities = source.m_entities;
+    m_rows     = source.m_rows;
+}
+} // namespace siren::core
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "ComponentColumn.hpp"
+#include "EntityHandle.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief Stores the components of a single type with ComponentStorage::SPARSE outside of the
+ * archetypes. The components are kept densely packed in a @ref ComponentColumn, and a sparse array
+ * indexed by the entity index maps each entity to its row, so adding, removing and looking up a
+ * component are O(1) without any hashing.
+ */
+class SparseSet
+{
+public:
+    /// @brief Marks the absence of a row.
+    static constexpr u32 NONE = ~0u;
+
+    explicit SparseSet(const ComponentTypeInfo* info) : m_components(info) { }
+
+    SparseSet(SparseSet&)            = delete;
+    SparseSet& operator=(SparseSet&) = delete;
+
+    /// @brief Returns the amount of components stored.
+    size_t size() const { return m_entities.size(); }
+
+    /// @brief Returns the entity of each row.
+    const Vector<EntityHandle>& getEntities() const { return m_entities; }
+
+    /// @brief Returns the densely packed components, row i belongs to getEntities()[i].
+    ComponentColumn& getColumn() { return m_components; }
+    const ComponentColumn& getColumn() const { return m_components; }
+
+    /// @brief Returns the row of entity's component, or NONE if entity has none.
+    u32 find(const EntityHandle entity) const
+    {
+        if (entity.index() >= m_rows.size()) { return NONE; }
+        const u32 row = m_rows[entity.index()];
+        return row != NONE && m_entities[row] == entity ? row : NONE;
+    }
+
+    /// @brief Checks if entity has a component in this set.
+    bool contains(const EntityHandle entity) const { return find(entity) != NONE; }
+
+    /// @brief Appends an uninitialized slot for entity, which must not be contained yet, and
+    /// returns its row. The caller must construct a component into the slot.
+    u32 insertUninitialized(EntityHandle entity);
+
+    /// @brief Destroys the component of entity and fills the gap with the last component. Does
+    /// nothing if entity has no component in this set.
+    void erase(EntityHandle entity);
+
+    /// @brief Destroys all components, the storage is kept.
+    void clear();
+
+    /// @brief Replaces the contents of this set with copies of the components of source, which
+    /// must store the same copyable type.
+    void assign(const SparseSet& source);
+
+private:
+    ComponentColumn m_components;
+    /// @brief The entity of each row.
+    Vector<EntityHandle> m_entities{ };
+    /// @brief The row of each entity, indexed by the entity's index.
+    Vector<u32> m_rows{ };
+};
+} // namespace siren::core
@@ -0,0 +1,232 @@
+#include "SpatialIndex.hpp"
+
+
+namespace siren::core
+{
+void SpatialIndex::update(const EntityHandle entity, const AABB& bounds)
+{
+    u32 leaf = find(entity);
+    if (leaf != NONE) {
+        m_nodes[leaf].tight = bounds;
+        // small movements stay within the fattened bounds and leave the tree untouched
+        if (m_nodes[leaf].bounds.Contains(bounds)) { return; }
+        removeLeaf(leaf);
+    } else {
+        leaf        = allocateNode();
+        Node& node  = m_nodes[leaf];
+        node.tight  = bounds;
+        node.height = 0;
+        node.entity = entity;
+        if (entity.index() >= m_leaves.size()) { m_leaves.resize(entity.index() + 1, NONE); }
+        m_leaves[entity.index()] = leaf;
+        m_size++;
+    }
+
+    m_nodes[leaf].bounds = bounds.Expanded(MARGIN);
+    insertLeaf(leaf);
+}
+
+void SpatialIndex::remove(const EntityHandle entity)
+{
+    const u32 leaf = find(entity);
+    if (leaf == NONE) { return; }
+
+    removeLeaf(leaf);
+    freeNode(leaf);
+    m_leaves[entity.index()] = NONE;
+    m_size--;
+}
+
+void SpatialIndex::clear()
+{
+    m_nodes.clear();
+    m_leaves.clear();
+    m_root     = NONE;
+    m_freeList = NONE;
+    m_size     = 0;
+}
+
+Maybe<SpatialIndex::RaycastHit> SpatialIndex::raycast(const Ray& ray, float maxDistance) const
+{
+    Maybe<RaycastHit> hit = Nothing;
+    // every hit shortens the ray, so later subtrees are pruned against the closest hit so far
+    traverse(
+        [&ray, &maxDistance] (const AABB& bounds) {
+            return ray.Intersect(bounds, maxDistance).has_value();
+        },
+        [&ray, &maxDistance, &hit] (const Node& leaf) {
+            if (const Maybe<float> distance = ray.Intersect(leaf.tight, maxDistance)) {
+                hit         = RaycastHit{ leaf.entity, *distance };
+                maxDistance = *distance;
+            }
+        }
+    );
+    return hit;
+}
+
+u32 SpatialIndex::allocateNode()
+{
+    if (m_freeList == NONE) {
+        m_nodes.emplace_back();
+        return static_cast<u32>(m_nodes.size() - 1);
+    }
+
+    const u32 node = m_freeList;
+    m_freeList     = m_nodes[node].left;
+    m_nodes[node]  = Node{ };
+    return node;
+}
+
+void SpatialIndex::freeNode(const u32 node)
+{
+    m_nodes[node] = Node{ .left = m_freeList, .height = -1 };
+    m_freeList    = node;
+}
+
+void SpatialIndex::insertLeaf(const u32 leaf)
+{
+    if (m_root == NONE) {
+        m_root               = leaf;
+        m_nodes[leaf].parent = NONE;
+        return;
+    }
+
+    // copied, allocating the new parent below may reallocate the nodes
+    const AABB bounds = m_nodes[leaf].bounds;
+
+    // descend towards the sibling whose union with the leaf increases the surface area least
+    u32 sibling = m_root;
+    while (!m_nodes[sibling].isLeaf()) {
+        const Node& node       = m_nodes[sibling];
+        const float area       = node.bounds.GetSurfaceArea();
+        const float mergedArea = AABB::Merge(node.bounds, bounds).GetSurfaceArea();
+
+        // the cost of making the leaf a sibling of this node, and the cost pushed down otherwise
+        const float cost          = 2.f * mergedArea;
+        const float inheritedCost = 2.f * (mergedArea - area);
+
+        const auto descendCost = [&] (const u32 child) {
+            const AABB& childBounds = m_nodes[child].bounds;
+            const float merged      = AABB::Merge(childBounds, bounds).GetSurfaceArea();
+            const float growth      = m_nodes[child].isLeaf()
+                                          ? merged
+                                          : merged - childBounds.GetSurfaceArea();
+            return growth + inheritedCost;
+        };
+        const float leftCost  = descendCost(node.left);
+        const float rightCost = descendCost(node.right);
+
+        if (cost < leftCost && cost < rightCost) { break; }
+        sibling = leftCost < rightCost ? node.left : node.right;
+    }
+
+    const u32 oldParent = m_nodes[sibling].parent;
+    const u32 parent    = allocateNode();
+    {
+        Node& node  = m_nodes[parent];
+        node.parent = oldParent;
+        node.left   = sibling;
+        node.right  = leaf;
+        node.height = m_nodes[sibling].height + 1;
+        node.bounds = AABB::Merge(m_nodes[sibling].bounds, bounds);
+    }
+    m_nodes[sibling].parent = parent;
+    m_nodes[leaf].parent    = parent;
+
+    if (oldParent == NONE) {
+        m_root = parent;
+    } else if (m_nodes[oldParent].left == sibling) {
+        m_nodes[oldParent].left = parent;
+    } else {
+        m_nodes[oldParent].right = parent;
+    }
+
+    refit(oldParent);
+}
+
+void SpatialIndex::removeLeaf(const u32 leaf)
+{
+    if (leaf == m_root) {
+        m_root = NONE;
+        return;
+    }
+
+    // the sibling takes the place of the parent, which is freed
+    const u32 parent      = m_nodes[leaf].parent;
+    const u32 grandParent = m_nodes[parent].parent;
+    const u32 sibling     =
+            m_nodes[parent].left == leaf ? m_nodes[parent].right : m_nodes[parent].left;
+
+    m_nodes[sibling].parent = grandParent;
+    if (grandParent == NONE) {
+        m_root = sibling;
+    } else if (m_nodes[grandParent].left == parent) {
+        m_nodes[grandParent].left = sibling;
+    } else {
+        m_nodes[grandParent].right = sibling;
+    }
+    freeNode(parent);
+    m_nodes[leaf].parent = NONE;
+
+    refit(grandParent);
+}
+
+void SpatialIndex::refit(u32 node)
+{
+    while (node != NONE) {
+        node = balance(node);
+
+        Node& current     = m_nodes[node];
+        const Node& left  = m_nodes[current.left];
+        const Node& right = m_nodes[current.right];
+        current.height    = 1 + std::max(left.height, right.height);
+        current.bounds    = AABB::Merge(left.bounds, right.bounds);
+
+        node = current.parent;
+    }
+}
+
+u32 SpatialIndex::balance(const u32 a)
+{
+    Node& nodeA = m_nodes[a];
+    if (nodeA.isLeaf() || nodeA.height < 2) { return a; }
+
+    const u32 b           = nodeA.left;
+    const u32 c           = nodeA.right;
+    const i32 balanceDiff = m_nodes[c].height - m_nodes[b].height;
+    if (balanceDiff >= -1 && balanceDiff <= 1) { return a; }
+
+    // the taller child becomes the root of the subtree, its taller child stays with it and the
+    // other one moves down to a
+    const u32 up   = balanceDiff > 1 ? c : b;
+    const u32 down = balanceDiff > 1 ? b : c;
+    Node& nodeUp   = m_nodes[up];
+    const u32 f    = nodeUp.left;
+    const u32 g    = nodeUp.right;
+
+    nodeUp.left   = a;
+    nodeUp.parent = nodeA.parent;
+    nodeA.parent  = up;
+    if (nodeUp.parent == NONE) {
+        m_root = up;
+    } else if (m_nodes[nodeUp.parent].left == a) {
+        m_nodes[nodeUp.parent].left = up;
+    } else {
+        m_nodes[nodeUp.parent].right = up;
+    }
+
+    const bool keepF      = m_nodes[f].height > m_nodes[g].height;
+    const u32 kept        = keepF ? f : g;
+    const u32 moved       = keepF ? g : f;
+    nodeUp.right          = kept;
+    nodeA.left            = down;
+    nodeA.right           = moved;
+    m_nodes[moved].parent = a;
+
+    nodeA.bounds  = AABB::Merge(m_nodes[down].bounds, m_nodes[moved].bounds);
+    nodeA.height  = 1 + std::max(m_nodes[down].height, m_nodes[moved].height);
+    nodeUp.bounds = AABB::Merge(nodeA.bounds, m_nodes[kept].bounds);
+    nodeUp.height = 1 + std::max(nodeA.height, m_nodes[kept].height);
+    return up;
+}
+} // namespace siren::core
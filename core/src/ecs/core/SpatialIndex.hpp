@@ -0,0 +1,214 @@
+#pragma once
+
+#include "EntityHandle.hpp"
+#include "geometry/Bounds.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief A bounding volume hierarchy over the world space bounds of entities, answering which
+ * entities lie in a region without looking at all of them. Maintained by the
+ * @ref SpatialIndexSystem and queried through the @ref Scene.
+ *
+ * The hierarchy is a dynamic AABB tree. Each leaf stores the tight bounds of an entity together
+ * with fattened bounds, so that entities moving by less than the margin do not touch the tree at
+ * all. Moving further removes and reinserts the leaf, choosing the sibling by the surface area
+ * heuristic, and rotations on the way up keep the tree balanced.
+ */
+class SpatialIndex
+{
+public:
+    /// @brief Marks the absence of a node.
+    static constexpr u32 NONE = ~0u;
+
+    /// @brief The result of Raycast().
+    struct RaycastHit
+    {
+        EntityHandle entity;
+        /// @brief The distance along the ray at which it enters the entity's bounds.
+        float distance;
+    };
+
+    /// @brief Returns the amount of entities in the index.
+    size_t size() const { return m_size; }
+
+    /// @brief Checks if entity is part of the index.
+    bool contains(const EntityHandle entity) const { return find(entity) != NONE; }
+
+    /// @brief Returns the world space bounds entity was last inserted or updated with. entity
+    /// must be part of the index.
+    const AABB& getBounds(const EntityHandle entity) const
+    {
+        const u32 leaf = find(entity);
+        SirenAssert(leaf != NONE, "Entity {} is not part of the spatial index", entity);
+        return m_nodes[leaf].tight;
+    }
+
+    /// @brief Inserts entity with the given world space bounds, or updates its bounds if it is
+    /// already part of the index.
+    void update(EntityHandle entity, const AABB& bounds);
+
+    /// @brief Removes entity from the index. Does nothing if it is not part of the index.
+    void remove(EntityHandle entity);
+
+    /// @brief Removes all entities.
+    void clear();
+
+    /// @brief Calls fn with each entity whose bounds intersect box.
+    template <typename Fn>
+    void queryBox(const AABB& box, Fn&& fn) const
+    {
+        traverse(
+            [&box] (const AABB& bounds) { return box.Intersects(bounds); },
+            [&box, &fn] (const Node& leaf) {
+                if (box.Intersects(leaf.tight)) { fn(leaf.entity); }
+            }
+        );
+    }
+
+    /// @brief Calls fn with each entity whose bounds intersect sphere.
+    template <typename Fn>
+    void querySphere(const BoundingSphere& sphere, Fn&& fn) const
+    {
+        traverse(
+            [&sphere] (const AABB& bounds) { return sphere.Intersects(bounds); },
+            [&sphere, &fn] (const Node& leaf) {
+                if (sphere.Intersects(leaf.tight)) { fn(leaf.entity); }
+            }
+        );
+    }
+
+    /// @brief Calls fn with each entity whose bounds intersect frustum. Subtrees lying completely
+    /// inside the frustum are reported without testing any of their leaves.
+    template <typename Fn>
+    void queryFrustum(const Frustum& frustum, Fn&& fn) const;
+
+    /// @brief Returns the entity whose bounds the ray enters first within maxDistance, or Nothing.
+    Maybe<RaycastHit> raycast(const Ray& ray, float maxDistance) const;
+
+private:
+    struct Node
+    {
+        /// @brief The fattened bounds of leaves, the union of the children otherwise.
+        AABB bounds;
+        /// @brief The bounds a leaf was inserted with, unused for inner nodes.
+        AABB tight;
+        u32 parent = NONE;
+        /// @brief The children of inner nodes, the left child doubles as the free list link.
+        u32 left  = NONE;
+        u32 right = NONE;
+        /// @brief The height of the subtree, 0 for leaves and -1 for free nodes.
+        i32 height = 0;
+        /// @brief The entity of a leaf.
+        EntityHandle entity;
+
+        bool isLeaf() const { return height == 0; }
+    };
+
+    /// @brief How far leaf bounds are fattened on each side.
+    static constexpr float MARGIN = 0.1f;
+    /// @brief The maximum depth of the traversal stack, ample for a balanced tree.
+    static constexpr size_t MAX_STACK_SIZE = 256;
+
+    Vector<Node> m_nodes{ };
+    u32 m_root     = NONE;
+    u32 m_freeList = NONE;
+    size_t m_size  = 0;
+    /// @brief The leaf of each entity, indexed by the entity's index.
+    Vector<u32> m_leaves{ };
+
+    /// @brief Returns the leaf of entity, or NONE.
+    u32 find(const EntityHandle entity) const
+    {
+        if (!entity || entity.index() >= m_leaves.size()) { return NONE; }
+        const u32 leaf = m_leaves[entity.index()];
+        return leaf != NONE && m_nodes[leaf].entity == entity ? leaf : NONE;
+    }
+
+    /**
+     * @brief Walks the tree depth first, descending into every node whose bounds pass visit and
+     * calling leafFn with each leaf that does.
+     */
+    template <typename Visit, typename LeafFn>
+    void traverse(Visit&& visit, LeafFn&& leafFn) const
+    {
+        if (m_root == NONE) { return; }
+
+        Array<u32, MAX_STACK_SIZE> stack;
+        size_t top   = 0;
+        stack[top++] = m_root;
+        while (top > 0) {
+            const Node& node = m_nodes[stack[--top]];
+            if (!visit(node.bounds)) { continue; }
+            if (node.isLeaf()) {
+                leafFn(node);
+                continue;
+            }
+            SirenAssert(top + 2 <= MAX_STACK_SIZE, "Spatial index traversal stack overflow");
+            stack[top++] = node.left;
+            stack[top++] = node.right;
+        }
+    }
+
+    /// @brief Calls fn with every entity in the subtree of node.
+    template <typename Fn>
+    void forEachLeaf(u32 node, Fn&& fn) const;
+
+    u32 allocateNode();
+    void freeNode(u32 node);
+    void insertLeaf(u32 leaf);
+    void removeLeaf(u32 leaf);
+    /// @brief Refits the bounds and heights of node and all its ancestors, rebalancing on the way.
+    void refit(u32 node);
+    /// @brief Rotates the subtree of node if it is unbalanced and returns its new root.
+    u32 balance(u32 node);
+};
+
+template <typename Fn>
+void SpatialIndex::queryFrustum(const Frustum& frustum, Fn&& fn) const
+{
+    if (m_root == NONE) { return; }
+
+    Array<u32, MAX_STACK_SIZE> stack;
+    size_t top   = 0;
+    stack[top++] = m_root;
+    while (top > 0) {
+        const u32 index  = stack[--top];
+        const Node& node = m_nodes[index];
+
+        const Frustum::Containment containment = frustum.Classify(node.bounds);
+        if (containment == Frustum::Containment::Outside) { continue; }
+        if (node.isLeaf()) {
+            if (frustum.Intersects(node.tight)) { fn(node.entity); }
+            continue;
+        }
+        if (containment == Frustum::Containment::Inside) {
+            forEachLeaf(index, fn);
+            continue;
+        }
+        SirenAssert(top + 2 <= MAX_STACK_SIZE, "Spatial index traversal stack overflow");
+        stack[top++] = node.left;
+        stack[top++] = node.right;
+    }
+}
+
+template <typename Fn>
+void SpatialIndex::forEachLeaf(const u32 node, Fn&& fn) const
+{
+    Array<u32, MAX_STACK_SIZE> stack;
+    size_t top   = 0;
+    stack[top++] = node;
+    while (top > 0) {
+        const Node& current = m_nodes[stack[--top]];
+        if (current.isLeaf()) {
+            fn(current.entity);
+            continue;
+        }
+        SirenAssert(top + 2 <= MAX_STACK_SIZE, "Spatial index traversal stack overflow");
+        stack[top++] = current.left;
+        stack[top++] = current.right;
+    }
+}
+} // namespace siren::core
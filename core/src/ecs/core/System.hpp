@@ -1,5 +1,8 @@
 #pragma once
 
+#include "SystemAccess.hpp"
+
+
 namespace siren::core
 {
 
@@ -43,6 +46,13 @@ public:
     virtual void onResume(Scene& scene)
     {
     };
+
+    /// @brief Returns the components this system accesses during onUpdate() and onRender(). Is
+    /// queried once on registration. Systems that do not override this run exclusively.
+    virtual SystemAccess getAccess() const
+    {
+        return SystemAccess::Exclusive();
+    };
 };
 
 } // namespace siren::ecs
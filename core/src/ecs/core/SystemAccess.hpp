@@ -0,0 +1,57 @@
+#pragma once
+
+#include "ComponentBitMap.hpp"
+#include "EntityManager.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief Describes which component types a @ref System reads and writes during onUpdate() and
+ * onRender(). The scheduler uses this to run systems of the same phase concurrently whenever their
+ * accesses do not conflict.
+ *
+ * Systems with non exclusive access must not make structural changes to the scene, i.e. create or
+ * destroy entities or add or remove components, and must not touch components they did not
+ * declare.
+ */
+struct SystemAccess
+{
+    using ComponentMask = EntityManager::ComponentMask;
+
+    /// @brief Components that are only read.
+    ComponentMask reads{ };
+    /// @brief Components that may be modified.
+    ComponentMask writes{ };
+    /// @brief An exclusive system conflicts with every other system and always runs on the thread
+    /// calling the update, which is required for anything touching the render context.
+    bool exclusive = false;
+
+    /// @brief Returns an exclusive access, the default for systems that do not declare one.
+    static SystemAccess Exclusive() { return SystemAccess{ .exclusive = true }; }
+
+    /// @brief Declares read access to the components Ts.
+    template <typename... Ts>
+    SystemAccess& read()
+    {
+        (reads.set(ComponentBitMap::getBitIndex<Ts>()), ...);
+        return *this;
+    }
+
+    /// @brief Declares write access to the components Ts. Writing implies reading.
+    template <typename... Ts>
+    SystemAccess& write()
+    {
+        (writes.set(ComponentBitMap::getBitIndex<Ts>()), ...);
+        return *this;
+    }
+
+    /// @brief Checks if two systems with these accesses may not run at the same time.
+    bool conflictsWith(const SystemAccess& o) const
+    {
+        if (exclusive || o.exclusive) { return true; }
+        return (writes & (o.reads | o.writes)).any() || (o.writes & reads).any();
+    }
+};
+} // namespace siren::core
@@ -2,9 +2,9 @@
 
 #include "System.hpp"
 #include "SystemPhase.hpp"
+#include "SystemSchedule.hpp"
 #include "utilities/Types.hpp"
 #include "utilities/spch.hpp"
-#include <ranges>
 
 
 namespace siren::core
@@ -23,9 +23,8 @@ public:
         const std::type_index systemIndex = index<T>();
         if (m_registeredSystems.contains(systemIndex)) { return false; }
 
-        m_systems[phase][systemIndex] = CreateOwn<T>();
-        const auto& system            = m_systems[phase][systemIndex];
-        system->onReady(scene); // maybe we want to only call this on scene start
+        System& system = m_systems[phase].add(systemIndex, CreateOwn<T>());
+        system.onReady(scene); // maybe we want to only call this on scene start
 
         m_registeredSystems[systemIndex] = phase;
 
@@ -44,47 +43,39 @@ public:
         const SystemPhase phase = m_registeredSystems[systemIndex];
         m_registeredSystems.erase(systemIndex);
 
-        m_systems[phase][systemIndex]->onShutdown(scene);
-        m_systems[phase].erase(systemIndex);
+        const Own<System> system = m_systems[phase].remove(systemIndex);
+        system->onShutdown(scene);
 
         return true;
     }
 
-    /// @brief Calls the onUpdate() method of all active systems in no specific order.
-    void onUpdate(const float delta, Scene& scene) const
+    /// @brief Calls the onUpdate() method of all active systems of the given phase. Systems run
+    /// concurrently where their declared @ref SystemAccess allows it.
+    void onUpdate(const SystemPhase phase, const float delta, Scene& scene) const
     {
-        for (const auto& bucket : m_systems) {
-            for (const auto& system : bucket | std::views::values) {
-                system->onUpdate(delta, scene); //
-            }
-        }
+        m_systems[phase].run([delta, &scene] (System& system) { system.onUpdate(delta, scene); });
     }
 
-    /// @brief Calls the onUpdate() method of all active systems in no specific order.
+    /// @brief Calls the onRender() method of all active systems phase by phase. Systems within a
+    /// phase run concurrently where their declared @ref SystemAccess allows it.
     void onRender(Scene& scene) const
     {
-        for (const auto& bucket : m_systems) {
-            for (const auto& system : bucket | std::views::values) {
-                system->onRender(scene); //
-            }
+        for (const auto& schedule : m_systems) {
+            schedule.run([&scene] (System& system) { system.onRender(scene); });
         }
     }
 
     void onPause(Scene& scene) const
     {
-        for (const auto& bucket : m_systems) {
-            for (const auto& system : bucket | std::views::values) {
-                system->onPause(scene); //
-            }
+        for (const auto& schedule : m_systems) {
+            schedule.forEach([&scene] (System& system) { system.onPause(scene); });
         }
     }
 
     void onResume(Scene& scene) const
     {
-        for (const auto& bucket : m_systems) {
-            for (const auto& system : bucket | std::views::values) {
-                system->onResume(scene); //
-            }
+        for (const auto& schedule : m_systems) {
+            schedule.forEach([&scene] (System& system) { system.onResume(scene); });
         }
     }
 
@@ -95,10 +86,8 @@ private:
         return std::type_index(typeid(T));
     }
 
-    using SystemBucket = HashMap<std::type_index, Own<System>>;
-
     /// @brief All the registered systems ordered by phase
-    Array<SystemBucket, SystemPhaseMax> m_systems{ };
+    Array<SystemSchedule, SystemPhaseMax> m_systems{ };
 
     /// @brief Unique type index per system type mapping to SystemPhase
     HashMap<std::type_index, SystemPhase> m_registeredSystems{ };
@@ -11,11 +11,14 @@ namespace siren::core
  * caller knows well enough to not do this. In the future, it may be nice to only expose some system
  * phases, and have core systems be fixed to their phases.
  *
- * @note Systems within a bucket are assumed to be execution order independent.
+ * @note Systems within a bucket are assumed to be execution order independent, except where their
+ * declared @ref SystemAccess conflicts. Non conflicting systems of a bucket may run concurrently,
+ * conflicting ones run in registration order.
  */
 enum SystemPhase
 {
     LogicPhase,
+    TransformPhase, // propagates transforms after all logic has run, see TransformSystem
     RenderPhase,
 
     SystemPhaseMax, // do not use, just indicates amount of phases
@@ -0,0 +1,119 @@
+#include "SystemSchedule.hpp"
+
+#include <deque>
+
+
+namespace siren::core
+{
+System& SystemSchedule::add(const std::type_index type, Own<System> system)
+{
+    const SystemAccess access = system->getAccess();
+    m_nodes.push_back(Node{ type, std::move(system), access });
+    rebuild();
+    return *m_nodes.back().system;
+}
+
+Own<System> SystemSchedule::remove(const std::type_index type)
+{
+    const auto it = std::ranges::find(m_nodes, type, &Node::type);
+    if (it == m_nodes.end()) { return nullptr; }
+
+    Own<System> system = std::move(it->system);
+    m_nodes.erase(it);
+    rebuild();
+    return system;
+}
+
+void SystemSchedule::forEach(const std::function<void(System&)>& fn) const
+{
+    for (const auto& node : m_nodes) { fn(*node.system); }
+}
+
+void SystemSchedule::run(const std::function<void(System&)>& fn) const
+{
+    ThreadPool& pool = ThreadPool::Get();
+    if (m_nodes.size() <= 1 || pool.getWorkerCount() == 0) {
+        forEach(fn);
+        return;
+    }
+
+    // shared between the calling thread and the workers, completed nodes are reported back to
+    // the calling thread which is the only one to touch the graph state
+    std::mutex mutex;
+    std::condition_variable condition;
+    Vector<u32> finished;
+
+    Vector<u32> pending(m_nodes.size());
+    std::deque<u32> ready;
+    for (u32 i = 0; i < m_nodes.size(); i++) {
+        pending[i] = m_nodes[i].dependencyCount;
+        if (pending[i] == 0) { ready.push_back(i); }
+    }
+
+    size_t completed = 0;
+    size_t inFlight  = 0;
+    Vector<u32> justFinished;
+
+    const auto complete = [&] (const u32 node) {
+        completed++;
+        for (const u32 dependent : m_nodes[node].dependents) {
+            if (--pending[dependent] == 0) { ready.push_back(dependent); }
+        }
+    };
+
+    while (completed < m_nodes.size()) {
+        // dispatch everything that may run concurrently, exclusive nodes have every other node as
+        // a dependency or dependent, so they are only ever ready once nothing is in flight
+        while (!ready.empty() && !m_nodes[ready.front()].access.exclusive) {
+            const u32 node = ready.front();
+            ready.pop_front();
+            inFlight++;
+            pool.submit(
+                [&, node] {
+                    fn(*m_nodes[node].system);
+                    // notify under the lock, the calling thread may return as soon as it sees the
+                    // last node finish, destroying the condition variable
+                    std::lock_guard lock{ mutex };
+                    finished.push_back(node);
+                    condition.notify_one();
+                }
+            );
+        }
+
+        if (!ready.empty() && inFlight == 0) {
+            const u32 node = ready.front();
+            ready.pop_front();
+            fn(*m_nodes[node].system);
+            complete(node);
+            continue;
+        }
+
+        {
+            std::unique_lock lock{ mutex };
+            condition.wait(lock, [&finished] { return !finished.empty(); });
+            std::swap(justFinished, finished);
+        }
+        for (const u32 node : justFinished) {
+            inFlight--;
+            complete(node);
+        }
+        justFinished.clear();
+    }
+}
+
+void SystemSchedule::rebuild()
+{
+    for (auto& node : m_nodes) {
+        node.dependents.clear();
+        node.dependencyCount = 0;
+    }
+
+    for (u32 later = 0; later < m_nodes.size(); later++) {
+        for (u32 earlier = 0; earlier < later; earlier++) {
+            if (!m_nodes[earlier].access.conflictsWith(m_nodes[later].access)) { continue; }
+            m_nodes[earlier].dependents.push_back(later);
+            m_nodes[later].dependencyCount++;
+        }
+    }
+}
+} // namespace siren::core
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "System.hpp"
+#include "core/ThreadPool.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief Owns the systems of one @ref SystemPhase and executes them as a dependency graph.
+ *
+ * Systems are ordered by registration. A system depends on every earlier system whose
+ * @ref SystemAccess conflicts with its own, so conflicting systems always run in registration
+ * order, while all other systems are dispatched to the @ref ThreadPool as soon as their
+ * dependencies have finished. Exclusive systems run on the calling thread.
+ */
+class SystemSchedule
+{
+public:
+    /// @brief Appends system to this schedule and returns it.
+    System& add(std::type_index type, Own<System> system);
+
+    /// @brief Removes the system of the given type and returns it, or nullptr if not present.
+    Own<System> remove(std::type_index type);
+
+    /// @brief Calls fn for each system, in registration order on the calling thread.
+    void forEach(const std::function<void(System&)>& fn) const;
+
+    /// @brief Calls fn for each system, concurrently where the system accesses allow it. Returns
+    /// once all systems have been processed.
+    void run(const std::function<void(System&)>& fn) const;
+
+private:
+    struct Node
+    {
+        std::type_index type;
+        Own<System> system;
+        SystemAccess access;
+        /// @brief Indices of later nodes that must wait for this node.
+        Vector<u32> dependents{ };
+        /// @brief The amount of earlier nodes this node waits for.
+        u32 dependencyCount = 0;
+    };
+
+    Vector<Node> m_nodes{ };
+
+    /// @brief Recomputes the dependency edges of all nodes.
+    void rebuild();
+};
+} // namespace siren::core
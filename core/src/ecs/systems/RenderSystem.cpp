@@ -11,20 +11,26 @@
 
 namespace siren::core
 {
+/// @brief Returns the camera component of entity, or nullptr if it has none. Camera components
+/// deriving from BaseCameraComponent have to be looked up here to be rendered from.
+static const BaseCameraComponent* getCamera(const Scene& scene, const EntityHandle entity)
+{
+    return scene.GetSafe<ThirdPersonCameraComponent>(entity);
+}
+
 void RenderSystem::onRender(Scene& scene)
 {
     auto& am = Assets();
     auto& rd = Renderer();
 
     // find the active camera to render from
+    // resolved every frame, the components move whenever their entity changes archetype
     const RenderContextComponent* rcc = scene.GetSingletonSafe<RenderContextComponent>();
-    if (!rcc->cameraComponent) { return; } // cannot draw
+    if (!rcc) { return; }
+    const BaseCameraComponent* camera = getCamera(scene, rcc->camera);
+    if (!camera) { return; } // cannot draw
 
-    const CameraInfo cameraInfo{
-        rcc->cameraComponent->getProjMat(),
-        rcc->cameraComponent->getViewMat(),
-        rcc->cameraComponent->position
-    };
+    const CameraInfo cameraInfo{ camera->getProjMat(), camera->getViewMat(), camera->position };
 
     LightInfo lightInfo;
     EnvironmentInfo envInfo;
@@ -32,7 +38,7 @@ void RenderSystem::onRender(Scene& scene)
     // setup lights
     {
         i32 lightCount = 0;
-        for (const auto& lightEntity : scene.GetWith<PointLightComponent, TransformComponent>()) {
+        for (const auto& [e, pointLight, transform] : scene.View<const PointLightComponent, const WorldTransformComponent>()) {
             if (lightCount >= MAX_LIGHT_COUNT) {
                 wrn(
                     "There are more than MAX_LIGHT_COUNT = {} PointLight's in the current scene, cannot render them all.",
@@ -40,44 +46,34 @@ void RenderSystem::onRender(Scene& scene)
                 );
                 break;
             }
-            const auto& pointLightComponent = scene.GetSafe<PointLightComponent>(lightEntity);
-            const auto& transformComponent  = scene.GetSafe<TransformComponent>(lightEntity);
-            if (!pointLightComponent) { continue; }
-            lightInfo.pointLights[lightCount] = GPUPointLight(
-                transformComponent->translation,
-                pointLightComponent->color
-            );
+            lightInfo.pointLights[lightCount] = GPUPointLight(glm::vec3{ transform.matrix[3] }, pointLight.color);
             lightCount++;
         }
         lightInfo.pointLightCount = lightCount;
         lightCount                = 0;
-        for (const auto& lightEntity : scene.GetWith<DirectionalLightComponent>()) {
+        for (const auto& [e, directionalLight] : scene.View<const DirectionalLightComponent>()) {
             if (lightCount >= 16) {
                 wrn("There are more than 16 DirectionalLight's in the current scene, cannot render them all.");
                 break;
             }
-            const auto& directionalLightComponent = scene.GetSafe<DirectionalLightComponent>(lightEntity);
-            if (!directionalLightComponent) { continue; }
             lightInfo.directionalLights[lightCount] = GPUDirectionalLight(
-                directionalLightComponent->direction,
-                directionalLightComponent->color
+                directionalLight.direction,
+                directionalLight.color
             );
             lightCount++;
         }
         lightInfo.directionalLightCount = lightCount;
         lightCount                      = 0;
-        for (const auto& lightEntity : scene.GetWith<SpotLightComponent>()) {
+        for (const auto& [e, spotLight] : scene.View<const SpotLightComponent>()) {
             if (lightCount >= 16) {
                 wrn("There are more than 16 SpotLight's in the current scene, cannot render them all.");
                 break;
             }
-            const auto& spotLightComponent = scene.GetSafe<SpotLightComponent>(lightEntity);
-            if (!spotLightComponent) { continue; }
             lightInfo.spotLights[lightCount] = GPUSpotLight(
-                spotLightComponent->position,
-                spotLightComponent->color,
-                spotLightComponent->innerCone,
-                spotLightComponent->outerCone
+                spotLight.position,
+                spotLight.color,
+                spotLight.innerCone,
+                spotLight.outerCone
             );
             lightCount++;
         }
@@ -87,8 +83,8 @@ void RenderSystem::onRender(Scene& scene)
 
     // setup environment
     {
-        if (rcc->skyBoxComponent) {
-            const auto cubeMap = am.GetAsset<TextureCubeMap>(rcc->skyBoxComponent->cubeMapHandle);
+        if (const auto skyBox = scene.GetSafe<SkyLightComponent>(rcc->skyBox)) {
+            const auto cubeMap = am.GetAsset<TextureCubeMap>(skyBox->cubeMapHandle);
             if (cubeMap) {
                 envInfo.skybox = cubeMap;
             } else {
@@ -101,18 +97,14 @@ void RenderSystem::onRender(Scene& scene)
     rd.BeginFrame({ cameraInfo, lightInfo, envInfo });
     rd.BeginPass(nullptr, glm::vec4{ 0.14, 0.14, 0.14, 1 });
 
-    // iterate over all drawable entities
-    for (const auto& e : scene.GetWith<MeshComponent, TransformComponent>()) {
-        const auto* meshComponent      = scene.GetSafe<MeshComponent>(e);
-        const auto* transformComponent = scene.GetSafe<TransformComponent>(e);
-
-        if (!meshComponent || !transformComponent) { continue; } // not enough info to draw
-
-        const auto mesh          = am.GetAsset<Mesh>(meshComponent->meshHandle);
-        const auto meshTransform = transformComponent->GetTransform();
-
-        Renderer().SubmitMesh(mesh, meshTransform);
-    }
+    // iterate over all drawable entities, their world transforms are computed by the
+    // TransformSystem
+    scene.Each<const MeshComponent, const WorldTransformComponent>(
+        [&am, &rd] (const MeshComponent& meshComponent, const WorldTransformComponent& transform) {
+            const auto mesh = am.GetAsset<Mesh>(meshComponent.meshHandle);
+            rd.SubmitMesh(mesh, transform.matrix);
+        }
+    );
 
     rd.EndPass();
     rd.EndFrame();
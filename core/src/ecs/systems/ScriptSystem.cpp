@@ -9,56 +9,56 @@ namespace siren::core
 {
 void ScriptSystem::onReady(Scene& scene)
 {
-    for (const auto e : scene.GetWith<ScriptContainerComponent>()) {
-        const auto* scripts = scene.GetSafe<ScriptContainerComponent>(e);
-        if (!scripts) { return; }
-        for (const auto& script : scripts->scripts) {
-            script->onReady(); //
+    scene.Each<const ScriptContainerComponent>(
+        [] (const ScriptContainerComponent& container) {
+            for (const auto& script : container.scripts) {
+                script->onReady(); //
+            }
         }
-    }
+    );
 }
 
 void ScriptSystem::onShutdown(Scene& scene)
 {
-    for (const auto e : scene.GetWith<ScriptContainerComponent>()) {
-        const auto* scripts = scene.GetSafe<ScriptContainerComponent>(e);
-        if (!scripts) { return; }
-        for (const auto& script : scripts->scripts) {
-            script->onShutdown(); //
+    scene.Each<const ScriptContainerComponent>(
+        [] (const ScriptContainerComponent& container) {
+            for (const auto& script : container.scripts) {
+                script->onShutdown(); //
+            }
         }
-    }
+    );
 }
 
 void ScriptSystem::onUpdate(const float delta, Scene& scene)
 {
-    for (const auto e : scene.GetWith<ScriptContainerComponent>()) {
-        const auto* scripts = scene.GetSafe<ScriptContainerComponent>(e);
-        if (!scripts) { return; }
-        for (const auto& script : scripts->scripts) {
-            script->onUpdate(delta); //
+    scene.Each<const ScriptContainerComponent>(
+        [delta] (const ScriptContainerComponent& container) {
+            for (const auto& script : container.scripts) {
+                script->onUpdate(delta); //
+            }
         }
-    }
+    );
 }
 
 void ScriptSystem::onPause(Scene& scene)
 {
-    for (const auto e : scene.GetWith<ScriptContainerComponent>()) {
-        const auto* scripts = scene.GetSafe<ScriptContainerComponent>(e);
-        if (!scripts) { return; }
-        for (const auto& script : scripts->scripts) {
-            script->onPause(); //
+    scene.Each<const ScriptContainerComponent>(
+        [] (const ScriptContainerComponent& container) {
+            for (const auto& script : container.scripts) {
+                script->onPause(); //
+            }
         }
-    }
+    );
 }
 
 void ScriptSystem::onResume(Scene& scene)
 {
-    for (const auto e : scene.GetWith<ScriptContainerComponent>()) {
-        const auto* scripts = scene.GetSafe<ScriptContainerComponent>(e);
-        if (!scripts) { return; }
-        for (const auto& script : scripts->scripts) {
-            script->onResume(); //
+    scene.Each<const ScriptContainerComponent>(
+        [] (const ScriptContainerComponent& container) {
+            for (const auto& script : container.scripts) {
+                script->onResume(); //
+            }
         }
-    }
+    );
 }
 } // namespace siren::ecs
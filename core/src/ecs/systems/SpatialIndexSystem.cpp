@@ -0,0 +1,89 @@
+#include "SpatialIndexSystem.hpp"
+
+#include "assets/AssetModule.hpp"
+#include "core/Core.hpp"
+#include "ecs/Components.hpp"
+#include "ecs/core/Scene.hpp"
+#include "geometry/Mesh.hpp"
+
+
+namespace siren::core
+{
+void SpatialIndexSystem::onUpdate(const float delta, Scene& scene)
+{
+    SpatialIndex& index = scene.GetSpatialIndex();
+
+    const auto refit = [&scene, &index] (
+        const EntityHandle entity,
+        const WorldTransformComponent& world
+    ) {
+        if (const Maybe<AABB> bounds = getLocalBounds(scene, entity)) {
+            index.update(entity, bounds->Transformed(world.matrix));
+        } else {
+            index.remove(entity);
+        }
+    };
+
+    scene.Changed<const WorldTransformComponent>(m_lastTick).each(refit);
+    scene.Changed<const BoundsComponent, const WorldTransformComponent>(m_lastTick).each(
+        [&refit] (
+            const EntityHandle entity,
+            const BoundsComponent&,
+            const WorldTransformComponent& world
+        ) { refit(entity, world); }
+    );
+    scene.Changed<const MeshComponent, const WorldTransformComponent>(m_lastTick).each(
+        [&refit] (
+            const EntityHandle entity,
+            const MeshComponent&,
+            const WorldTransformComponent& world
+        ) { refit(entity, world); }
+    );
+    scene.Added<const PointLightComponent, const WorldTransformComponent>(m_lastTick).each(
+        [&refit] (
+            const EntityHandle entity,
+            const PointLightComponent&,
+            const WorldTransformComponent& world
+        ) { refit(entity, world); }
+    );
+    scene.Added<const SpotLightComponent, const WorldTransformComponent>(m_lastTick).each(
+        [&refit] (
+            const EntityHandle entity,
+            const SpotLightComponent&,
+            const WorldTransformComponent& world
+        ) { refit(entity, world); }
+    );
+
+    m_lastTick = scene.AdvanceChangeTick();
+}
+
+bool SpatialIndexSystem::IsIndexed(const Scene& scene, const EntityHandle entity)
+{
+    return scene.hasComponent<WorldTransformComponent>(entity) && hasBounds(scene, entity);
+}
+
+bool SpatialIndexSystem::hasBounds(const Scene& scene, const EntityHandle entity)
+{
+    return scene.hasComponent<BoundsComponent>(entity) ||
+           scene.hasComponent<MeshComponent>(entity) ||
+           scene.hasComponent<PointLightComponent>(entity) ||
+           scene.hasComponent<SpotLightComponent>(entity);
+}
+
+Maybe<AABB> SpatialIndexSystem::getLocalBounds(const Scene& scene, const EntityHandle entity)
+{
+    if (const auto* bounds = scene.GetSafe<const BoundsComponent>(entity)) {
+        return bounds->bounds;
+    }
+    if (const auto* mesh = scene.GetSafe<const MeshComponent>(entity)) {
+        const Ref<Mesh> asset = Assets().GetAsset<Mesh>(mesh->meshHandle);
+        if (asset && !asset->GetBounds().IsEmpty()) { return asset->GetBounds(); }
+        return Nothing;
+    }
+    if (scene.hasComponent<PointLightComponent>(entity) ||
+        scene.hasComponent<SpotLightComponent>(entity)) {
+        return AABB{ glm::vec3{ 0.f }, glm::vec3{ 0.f } };
+    }
+    return Nothing;
+}
+} // namespace siren::core
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "ecs/core/EntityHandle.hpp"
+#include "ecs/core/System.hpp"
+#include "geometry/Bounds.hpp"
+
+namespace siren::core
+{
+/**
+ * @brief Keeps the scene's @ref SpatialIndex up to date with the world space bounds of all
+ * entities that have a WorldTransformComponent and local bounds. Local bounds are taken from the
+ * BoundsComponent if present, otherwise from the bounds of the MeshComponent's mesh. Point and
+ * spot lights without either are indexed as a point.
+ *
+ * Only entities whose world transform or bounds changed since the last update are refitted, most
+ * of which stay within their fattened bounds and leave the tree untouched. Entities that lose
+ * their world transform or bounds, or are destroyed, are removed by the scene right away.
+ *
+ * Must run after the @ref TransformSystem. Runs exclusively, as it modifies the index.
+ */
+class SpatialIndexSystem final : public System
+{
+public:
+    void onUpdate(float delta, Scene& scene) override;
+
+    /// @brief Checks if entity belongs into the index, i.e. has a world transform and local
+    /// bounds.
+    static bool IsIndexed(const Scene& scene, EntityHandle entity);
+
+private:
+    /// @brief The change tick of the previous update, see Scene::Changed().
+    u32 m_lastTick = 0;
+
+    /// @brief Checks if entity has any component local bounds are taken from.
+    static bool hasBounds(const Scene& scene, EntityHandle entity);
+    /// @brief Returns the local bounds of entity, or Nothing if it has none.
+    static Maybe<AABB> getLocalBounds(const Scene& scene, EntityHandle entity);
+};
+
+} // namespace siren::core
@@ -0,0 +1,100 @@
+#include "TransformSystem.hpp"
+
+#include "ecs/components/TransformComponent.hpp"
+#include "ecs/components/WorldTransformComponent.hpp"
+#include "ecs/core/Scene.hpp"
+
+
+namespace siren::core
+{
+void TransformSystem::onUpdate(const float delta, Scene& scene)
+{
+    // new transforms receive their world transform before the first propagation
+    Vector<EntityHandle> missing;
+    scene.Added<const TransformComponent>(m_lastTick).each(
+        [&scene, &missing] (const EntityHandle entity, const TransformComponent&) {
+            if (!scene.hasComponent<WorldTransformComponent>(entity)) { missing.push_back(entity); }
+        }
+    );
+    // added right away, the propagation below has to see them this frame
+    for (const EntityHandle entity : missing) {
+        scene.EmplaceImmediate<WorldTransformComponent>(entity);
+    }
+
+    const Hierarchy& hierarchy = scene.GetHierarchy();
+    m_dirtyNodes.clear();
+    m_dirtyTransforms.clear();
+    m_rootTransforms.clear();
+
+    // added components count as changed, so this also covers the entities from above
+    scene.Changed<TransformComponent, WorldTransformComponent>(m_lastTick).each(
+        [this, &hierarchy] (
+            const EntityHandle entity,
+            TransformComponent& transform,
+            WorldTransformComponent& world
+        ) {
+            if (transform.IsDirty()) { m_dirtyTransforms.push_back(&transform); }
+
+            const u32 node = hierarchy.find(entity);
+            if (node == Hierarchy::NONE) {
+                m_rootTransforms.emplace_back(&transform, &world);
+            } else {
+                m_dirtyNodes.push_back(node);
+            }
+        }
+    );
+    TransformComponent::UpdateTransforms(m_dirtyTransforms);
+
+    // entities outside the hierarchy have no parent, so their world transform is their local one
+    for (const auto& [transform, world] : m_rootTransforms) {
+        world->matrix = transform->GetTransform();
+    }
+    for (u32 i = 0; i < hierarchy.size(); i++) {
+        if (hierarchy[i].changedTick > m_lastTick) { m_dirtyNodes.push_back(i); }
+    }
+
+    // subtrees are contiguous and sorted by their root, so a dirty node either starts a new
+    // subtree or lies inside the previous one
+    std::ranges::sort(m_dirtyNodes);
+    u32 end = 0;
+    for (const u32 node : m_dirtyNodes) {
+        if (node < end) { continue; }
+        end = node + hierarchy[node].size;
+        propagate(scene, node, end);
+    }
+
+    m_lastTick = scene.AdvanceChangeTick();
+}
+
+void TransformSystem::propagate(Scene& scene, const u32 begin, const u32 end)
+{
+    const Hierarchy& hierarchy = scene.GetHierarchy();
+    m_worlds.resize(end - begin);
+
+    for (u32 i = begin; i < end; i++) {
+        const Hierarchy::Node& node = hierarchy[i];
+        const glm::mat4 parentWorld =
+                i == begin ? getParentWorld(scene, i) : m_worlds[node.parentIndex - begin];
+
+        // entities without a transform pass their parent's world transform on to their children
+        glm::mat4& world = m_worlds[i - begin];
+        world            = parentWorld;
+        if (const auto* transform = scene.GetSafe<const TransformComponent>(node.entity)) {
+            world = parentWorld * transform->GetTransform();
+            if (auto* worldTransform = scene.GetSafe<WorldTransformComponent>(node.entity)) {
+                worldTransform->matrix = world;
+            }
+        }
+    }
+}
+
+glm::mat4 TransformSystem::getParentWorld(const Scene& scene, const u32 index)
+{
+    const Hierarchy& hierarchy = scene.GetHierarchy();
+    for (u32 i = hierarchy[index].parentIndex; i != Hierarchy::NONE; i = hierarchy[i].parentIndex) {
+        const auto* world = scene.GetSafe<const WorldTransformComponent>(hierarchy[i].entity);
+        if (world) { return world->matrix; }
+    }
+    return glm::mat4{ 1.f };
+}
+} // namespace siren::core
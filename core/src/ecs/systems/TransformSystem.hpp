@@ -0,0 +1,46 @@
+#pragma once
+
+#include "ecs/core/EntityHandle.hpp"
+#include "ecs/core/System.hpp"
+
+namespace siren::core
+{
+struct TransformComponent;
+struct WorldTransformComponent;
+
+/**
+ * @brief Keeps the @ref WorldTransformComponent of every entity with a TransformComponent up to
+ * date by composing it with its ancestors in the scene's @ref Hierarchy.
+ *
+ * Only entities whose TransformComponent changed or that were reparented since the last update,
+ * and their subtrees, are recomputed. Since the hierarchy stores each subtree as a contiguous range
+ * with parents first, every dirty subtree is a single linear scan and subtrees nested in another
+ * dirty subtree are skipped.
+ *
+ * Cached local matrices of all changed transforms are recomputed in one batch beforehand.
+ *
+ * Runs exclusively, as it adds missing WorldTransformComponent's directly.
+ */
+class TransformSystem final : public System
+{
+public:
+    void onUpdate(float delta, Scene& scene) override;
+
+private:
+    /// @brief The change tick of the previous update, see Scene::Changed().
+    u32 m_lastTick = 0;
+    /// @brief Reused between updates to avoid allocating each frame.
+    Vector<u32> m_dirtyNodes{ };
+    Vector<TransformComponent*> m_dirtyTransforms{ };
+    Vector<std::pair<TransformComponent*, WorldTransformComponent*>> m_rootTransforms{ };
+    Vector<glm::mat4> m_worlds{ };
+
+    /// @brief Computes the world transforms of the hierarchy nodes [begin, end), which must be a
+    /// complete subtree.
+    void propagate(Scene& scene, u32 begin, u32 end);
+    /// @brief Returns the world transform of the closest ancestor of the node at index that has
+    /// one, or identity.
+    static glm::mat4 getParentWorld(const Scene& scene, u32 index);
+};
+
+} // namespace siren::core
@@ -0,0 +1,166 @@
+#include "Bounds.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define SIREN_BOUNDS_SSE
+#include <xmmintrin.h>
+#endif
+
+
+namespace siren::core
+{
+AABB AABB::FromPoints(const std::span<const glm::vec3> points)
+{
+    AABB box;
+    size_t i = 0;
+
+#ifdef SIREN_BOUNDS_SSE
+    static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "Points must be tightly packed");
+    if (points.size() >= 4) {
+        // four packed points are exactly three registers, laid out as xyzx yzxy zxyz, so each
+        // register keeps reducing the same components in the same lanes
+        const float* data = &points[0].x;
+        __m128 min0       = _mm_loadu_ps(data);
+        __m128 min1       = _mm_loadu_ps(data + 4);
+        __m128 min2       = _mm_loadu_ps(data + 8);
+        __m128 max0       = min0;
+        __m128 max1       = min1;
+        __m128 max2       = min2;
+        for (i = 4; i + 4 <= points.size(); i += 4) {
+            const float* p = data + i * 3;
+            const __m128 a = _mm_loadu_ps(p);
+            const __m128 b = _mm_loadu_ps(p + 4);
+            const __m128 c = _mm_loadu_ps(p + 8);
+            min0           = _mm_min_ps(min0, a);
+            min1           = _mm_min_ps(min1, b);
+            min2           = _mm_min_ps(min2, c);
+            max0           = _mm_max_ps(max0, a);
+            max1           = _mm_max_ps(max1, b);
+            max2           = _mm_max_ps(max2, c);
+        }
+
+        alignas(16) float lo[12];
+        alignas(16) float hi[12];
+        _mm_store_ps(lo, min0);
+        _mm_store_ps(lo + 4, min1);
+        _mm_store_ps(lo + 8, min2);
+        _mm_store_ps(hi, max0);
+        _mm_store_ps(hi + 4, max1);
+        _mm_store_ps(hi + 8, max2);
+        // lane j of the twelve holds component j % 3
+        for (size_t lane = 0; lane < 12; lane += 3) {
+            box.Merge(glm::vec3{ lo[lane], lo[lane + 1], lo[lane + 2] });
+            box.Merge(glm::vec3{ hi[lane], hi[lane + 1], hi[lane + 2] });
+        }
+    }
+#endif
+
+    for (; i < points.size(); i++) { box.Merge(points[i]); }
+    return box;
+}
+
+BoundingSphere BoundingSphere::FromPoints(const std::span<const glm::vec3> points, const AABB& box)
+{
+    if (box.IsEmpty()) { return BoundingSphere{ }; }
+
+    const glm::vec3 center = box.GetCenter();
+    float radiusSquared    = 0.f;
+    for (const glm::vec3& point : points) {
+        const glm::vec3 offset = point - center;
+        radiusSquared          = std::max(radiusSquared, glm::dot(offset, offset));
+    }
+    return BoundingSphere{ center, std::sqrt(radiusSquared) };
+}
+
+AABB AABB::Transformed(const glm::mat4& matrix) const
+{
+    if (IsEmpty()) { return *this; }
+
+    // the extents of the transformed box are the absolute rotated and scaled extents
+    const glm::vec3 center  = glm::vec3{ matrix * glm::vec4{ GetCenter(), 1.f } };
+    const glm::vec3 extents = GetExtents();
+    const glm::vec3 transformed =
+            glm::abs(glm::vec3{ matrix[0] }) * extents.x +
+            glm::abs(glm::vec3{ matrix[1] }) * extents.y +
+            glm::abs(glm::vec3{ matrix[2] }) * extents.z;
+    return AABB{ center - transformed, center + transformed };
+}
+
+void BoundingSphere::Merge(const BoundingSphere& other)
+{
+    const glm::vec3 offset = other.center - center;
+    const float distance   = glm::length(offset);
+    if (distance + other.radius <= radius) { return; }
+    if (distance + radius <= other.radius) {
+        *this = other;
+        return;
+    }
+
+    // the merged sphere touches the far sides of both spheres along the line through the centers
+    const float merged = (distance + radius + other.radius) * 0.5f;
+    center += offset * ((merged - radius) / distance);
+    radius = merged;
+}
+
+BoundingSphere BoundingSphere::Transformed(const glm::mat4& matrix) const
+{
+    const float scale = std::sqrt(
+        std::max(
+            {
+                glm::dot(glm::vec3{ matrix[0] }, glm::vec3{ matrix[0] }),
+                glm::dot(glm::vec3{ matrix[1] }, glm::vec3{ matrix[1] }),
+                glm::dot(glm::vec3{ matrix[2] }, glm::vec3{ matrix[2] }),
+            }
+        )
+    );
+    return BoundingSphere{ glm::vec3{ matrix * glm::vec4{ center, 1.f } }, radius * scale };
+}
+
+Maybe<float> Ray::Intersect(const AABB& box, const float maxDistance) const
+{
+    // slab test, divisions by zero yield infinities which compare correctly
+    const glm::vec3 inverse = 1.f / direction;
+    const glm::vec3 t0      = (box.min - origin) * inverse;
+    const glm::vec3 t1      = (box.max - origin) * inverse;
+    const glm::vec3 entries = glm::min(t0, t1);
+    const glm::vec3 exits   = glm::max(t0, t1);
+
+    const float enter = std::max({ entries.x, entries.y, entries.z, 0.f });
+    const float exit  = std::min({ exits.x, exits.y, exits.z, maxDistance });
+    if (enter > exit) { return Nothing; }
+    return enter;
+}
+
+Frustum Frustum::FromMatrix(const glm::mat4& viewProjection)
+{
+    // Gribb & Hartmann, each plane is the fourth row plus or minus one of the other rows
+    const glm::mat4 m = glm::transpose(viewProjection);
+
+    Frustum frustum;
+    frustum.planes = {
+        m[3] + m[0], // left
+        m[3] - m[0], // right
+        m[3] + m[1], // bottom
+        m[3] - m[1], // top
+        m[3] + m[2], // near
+        m[3] - m[2], // far
+    };
+    for (glm::vec4& plane : frustum.planes) { plane /= glm::length(glm::vec3{ plane }); }
+    return frustum;
+}
+
+Frustum::Containment Frustum::Classify(const AABB& box) const
+{
+    const glm::vec3 center  = box.GetCenter();
+    const glm::vec3 extents = box.GetExtents();
+
+    Containment result = Containment::Inside;
+    for (const glm::vec4& plane : planes) {
+        const glm::vec3 normal = glm::vec3{ plane };
+        const float distance   = glm::dot(normal, center) + plane.w;
+        const float radius     = glm::dot(glm::abs(normal), extents);
+        if (distance < -radius) { return Containment::Outside; }
+        if (distance < radius) { result = Containment::Intersects; }
+    }
+    return result;
+}
+} // namespace siren::core
@@ -0,0 +1,176 @@
+/**
+ * @file Bounds.hpp
+ * @brief Bounding volumes and the intersection tests between them.
+ */
+#pragma once
+
+#include "utilities/spch.hpp"
+
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <glm/vector_relational.hpp>
+
+#include <span>
+
+
+namespace siren::core
+{
+/**
+ * @brief An axis aligned bounding box. A default constructed box is empty, i.e. its min is greater
+ * than its max, so that merging anything into it yields exactly the merged volume.
+ */
+struct AABB
+{
+    glm::vec3 min{ std::numeric_limits<float>::max() };
+    glm::vec3 max{ std::numeric_limits<float>::lowest() };
+
+    AABB() = default;
+    AABB(const glm::vec3& min, const glm::vec3& max) : min(min), max(max) { }
+
+    /// @brief Returns the smallest box enclosing all points. Four points are reduced at a time
+    /// where SIMD is supported.
+    static AABB FromPoints(std::span<const glm::vec3> points);
+
+    /// @brief Checks if the box encloses nothing, not even a single point.
+    bool IsEmpty() const { return glm::any(glm::greaterThan(min, max)); }
+
+    glm::vec3 GetCenter() const { return (min + max) * 0.5f; }
+
+    /// @brief Returns the half size of the box along each axis.
+    glm::vec3 GetExtents() const { return (max - min) * 0.5f; }
+
+    float GetSurfaceArea() const
+    {
+        const glm::vec3 size = max - min;
+        return 2.f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    /// @brief Grows the box to enclose point.
+    void Merge(const glm::vec3& point)
+    {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+
+    /// @brief Grows the box to enclose other.
+    void Merge(const AABB& other)
+    {
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+    }
+
+    /// @brief Returns the smallest box enclosing both a and b.
+    static AABB Merge(const AABB& a, const AABB& b)
+    {
+        return AABB{ glm::min(a.min, b.min), glm::max(a.max, b.max) };
+    }
+
+    /// @brief Returns the box grown by margin on each side.
+    AABB Expanded(const float margin) const { return AABB{ min - margin, max + margin }; }
+
+    bool Contains(const glm::vec3& point) const
+    {
+        return glm::all(glm::lessThanEqual(min, point)) && glm::all(glm::lessThanEqual(point, max));
+    }
+
+    bool Contains(const AABB& other) const
+    {
+        return glm::all(glm::lessThanEqual(min, other.min)) &&
+               glm::all(glm::lessThanEqual(other.max, max));
+    }
+
+    bool Intersects(const AABB& other) const
+    {
+        return glm::all(glm::lessThanEqual(min, other.max)) &&
+               glm::all(glm::lessThanEqual(other.min, max));
+    }
+
+    /// @brief Returns the smallest axis aligned box enclosing this box transformed by matrix.
+    AABB Transformed(const glm::mat4& matrix) const;
+};
+
+/**
+ * @brief A sphere given by its center and radius.
+ */
+struct BoundingSphere
+{
+    glm::vec3 center{ 0.f };
+    float radius = 0.f;
+
+    BoundingSphere() = default;
+    BoundingSphere(const glm::vec3& center, const float radius) : center(center), radius(radius) { }
+
+    /// @brief Returns a sphere around the center of box, which must enclose all points, that is
+    /// just large enough to enclose all points. Usually much tighter than the sphere around box.
+    static BoundingSphere FromPoints(std::span<const glm::vec3> points, const AABB& box);
+
+    bool Contains(const glm::vec3& point) const
+    {
+        const glm::vec3 offset = point - center;
+        return glm::dot(offset, offset) <= radius * radius;
+    }
+
+    bool Intersects(const AABB& box) const
+    {
+        const glm::vec3 offset = glm::clamp(center, box.min, box.max) - center;
+        return glm::dot(offset, offset) <= radius * radius;
+    }
+
+    /// @brief Grows the sphere to the smallest sphere enclosing both itself and other.
+    void Merge(const BoundingSphere& other);
+
+    /// @brief Returns a sphere enclosing this sphere transformed by matrix. Non uniform scale
+    /// grows the radius by the largest scale factor.
+    BoundingSphere Transformed(const glm::mat4& matrix) const;
+};
+
+/**
+ * @brief A half line starting at origin. The direction does not need to be normalized, distances
+ * are then measured in multiples of its length.
+ */
+struct Ray
+{
+    glm::vec3 origin{ 0.f };
+    glm::vec3 direction{ 0.f, 0.f, -1.f };
+
+    Ray() = default;
+    Ray(const glm::vec3& origin, const glm::vec3& direction)
+        : origin(origin), direction(direction) { }
+
+    glm::vec3 GetPoint(const float distance) const { return origin + direction * distance; }
+
+    /// @brief Returns the distance at which the ray enters box, 0 if it starts inside of it, or
+    /// Nothing if it misses box or only reaches it beyond maxDistance.
+    Maybe<float> Intersect(const AABB& box, float maxDistance) const;
+};
+
+/**
+ * @brief The six planes enclosing the volume visible to a camera. Each plane is stored as
+ * (normal, distance) with the normal pointing into the volume.
+ */
+struct Frustum
+{
+    enum class Containment { Outside, Intersects, Inside };
+
+    Array<glm::vec4, 6> planes{ };
+
+    /// @brief Extracts the planes of the given projection * view matrix.
+    static Frustum FromMatrix(const glm::mat4& viewProjection);
+
+    /// @brief Checks if box lies outside, inside or on the boundary of the frustum. Boxes close
+    /// to the corners may be classified as intersecting although they are outside.
+    Containment Classify(const AABB& box) const;
+
+    bool Intersects(const AABB& box) const { return Classify(box) != Containment::Outside; }
+
+    bool Intersects(const BoundingSphere& sphere) const
+    {
+        for (const glm::vec4& plane : planes) {
+            if (glm::dot(glm::vec3{ plane }, sphere.center) + plane.w < -sphere.radius) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+} // namespace siren::core
@@ -6,6 +6,15 @@ namespace siren::core
 void Mesh::AddSurface(const Surface& surface)
 {
     m_surfaces.push_back(surface);
+    if (surface.bounds.IsEmpty()) { return; }
+
+    const BoundingSphere sphere = surface.boundingSphere.Transformed(surface.transform);
+    if (m_bounds.IsEmpty()) {
+        m_boundingSphere = sphere;
+    } else {
+        m_boundingSphere.Merge(sphere);
+    }
+    m_bounds.Merge(surface.bounds.Transformed(surface.transform));
 }
 
 const Vector<Mesh::Surface>& Mesh::GetSurfaces() const
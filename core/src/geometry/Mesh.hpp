@@ -4,7 +4,8 @@
 #pragma once
 
 #include "assets/Asset.hpp"
-#include "renderer/buffer/Buffer.hpp"
+#include "geometry/Bounds.hpp"
+#include "renderer/GeometryArena.hpp"
 
 
 namespace siren::core
@@ -22,24 +23,33 @@ public:
     ~Mesh() override = default;
 
     /**
-     * @brief A collection of a transform, a @ref Material and a @ref VertexArray. Equates to a
-     * single draw call.
+     * @brief A collection of a transform, a @ref Material and geometry living in the
+     * @ref GeometryArena. Equates to a single draw call.
      */
     struct Surface
     {
         glm::mat4 transform{ 1 };
-        AssetHandle materialHandle = utilities::UUID::invalid();
-        Ref<Buffer> vertices       = nullptr;
-        Ref<Buffer> indices        = nullptr;
-        u32 indexCount;
+        AssetHandle materialHandle       = utilities::UUID::invalid();
+        Ref<GeometryAllocation> geometry = nullptr;
+        /// @brief The bounds of the vertices, before applying the transform.
+        AABB bounds{ };
+        /// @brief A sphere enclosing the vertices, before applying the transform.
+        BoundingSphere boundingSphere{ };
     };
 
-    /// @brief Adds a new surface to the mesh.
+    /// @brief Adds a new surface to the mesh and grows the mesh bounds to enclose it.
     void AddSurface(const Surface& surface);
     /// @brief Returns a read only reference to this mesh's surfaces.
     const Vector<Surface>& GetSurfaces() const;
 
+    /// @brief Returns the bounds of all surfaces in mesh space, i.e. with their transforms applied.
+    const AABB& GetBounds() const { return m_bounds; }
+    /// @brief Returns a sphere enclosing all surfaces in mesh space.
+    const BoundingSphere& GetBoundingSphere() const { return m_boundingSphere; }
+
 private:
     Vector<Surface> m_surfaces{ };
+    AABB m_bounds{ };
+    BoundingSphere m_boundingSphere{ };
 };
 } // namespace siren::core
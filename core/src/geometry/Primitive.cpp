@@ -4,7 +4,6 @@
 
 #include "glm/gtc/constants.hpp"
 #include "glm/trigonometric.hpp"
-#include "renderer/buffer/Buffer.hpp"
 
 // many of these generation algorithms have been adapted from three.js
 // https://github.com/mrdoob/three.js/tree/dev
@@ -76,9 +75,8 @@ Ref<PrimitiveMeshData> GeneratePlane(const PlaneParams& params, const VertexLayo
         }
     }
 
-    auto indexBuffer = CreateRef<Buffer>(indices.data(), indices.size() * sizeof(u32), BufferUsage::Static);
-
-    return CreateRef<PrimitiveMeshData>(vbb.Build(), indexBuffer, indices.size());
+    const AABB bounds = vbb.GetBounds();
+    return CreateRef<PrimitiveMeshData>(vbb.Build(indices), bounds, vbb.GetBoundingSphere(bounds));
 }
 
 Ref<PrimitiveMeshData> GenerateCapsule(const CapsuleParams& params, const VertexLayout& layout)
@@ -179,8 +177,8 @@ Ref<PrimitiveMeshData> GenerateCapsule(const CapsuleParams& params, const Vertex
         }
     }
 
-    const auto indexBuffer = CreateRef<Buffer>(indices.data(), indices.size() * sizeof(u32), BufferUsage::Static);
-    return CreateRef<PrimitiveMeshData>(vbb.Build(), indexBuffer, indices.size());
+    const AABB bounds = vbb.GetBounds();
+    return CreateRef<PrimitiveMeshData>(vbb.Build(indices), bounds, vbb.GetBoundingSphere(bounds));
 }
 
 Ref<PrimitiveMeshData> GenerateCube(const CubeParams& params, const VertexLayout& layout)
@@ -249,8 +247,8 @@ Ref<PrimitiveMeshData> GenerateCube(const CubeParams& params, const VertexLayout
     // -Z face
     addFace({ 0, 0, -halfSize }, { -size, 0, 0 }, { 0, size, 0 }, widthSegs, heightSegs);
 
-    auto indexBuffer = CreateRef<Buffer>(indices.data(), indices.size() * sizeof(u32), BufferUsage::Static);
-    return CreateRef<PrimitiveMeshData>(vbb.Build(), indexBuffer, indices.size());
+    const AABB bounds = vbb.GetBounds();
+    return CreateRef<PrimitiveMeshData>(vbb.Build(indices), bounds, vbb.GetBoundingSphere(bounds));
 }
 
 std::string CreatePrimitiveName(const PrimitiveParams& params)
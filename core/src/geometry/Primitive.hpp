@@ -4,8 +4,9 @@
  */
 #pragma once
 
-#include "renderer/buffer/Buffer.hpp"
+#include "renderer/GeometryArena.hpp"
 #include "renderer/buffer/VertexLayout.hpp"
+#include "geometry/Bounds.hpp"
 
 #include "utilities/spch.hpp"
 
@@ -89,9 +90,9 @@ struct CubeParams
 
 struct PrimitiveMeshData
 {
-    Ref<Buffer> vertices;
-    Ref<Buffer> indices;
-    u32 indexCount;
+    Ref<GeometryAllocation> geometry;
+    AABB bounds;
+    BoundingSphere boundingSphere;
 };
 
 
@@ -1,5 +1,7 @@
 #include "VertexBufferBuilder.hpp"
 
+#include "renderer/RenderModule.hpp"
+
 
 namespace siren::core
 {
@@ -32,6 +34,7 @@ VertexBufferBuilder::VertexBufferBuilder(const VertexLayout& layout) : m_layout(
 void VertexBufferBuilder::PushVertex(const CompleteVertex& vertex)
 {
     m_count++;
+    m_positions.push_back(vertex.position);
 
     const u32 previousSize = m_data.size();
     m_data.resize(previousSize + m_layout.GetVertexStride());
@@ -45,13 +48,23 @@ void VertexBufferBuilder::PushVertex(const CompleteVertex& vertex)
     }
 }
 
-Ref<Buffer> VertexBufferBuilder::Build() const
+Ref<GeometryAllocation> VertexBufferBuilder::Build(const std::span<const u32> indices) const
 {
-    return CreateRef<Buffer>(m_data.data(), m_data.size(), BufferUsage::Static);
+    return Renderer().GetGeometryArena().Allocate(m_data, m_layout.GetVertexStride(), indices);
 }
 
 u32 VertexBufferBuilder::GetSize() const
 {
     return m_count;
 }
+
+AABB VertexBufferBuilder::GetBounds() const
+{
+    return AABB::FromPoints(m_positions);
+}
+
+BoundingSphere VertexBufferBuilder::GetBoundingSphere(const AABB& bounds) const
+{
+    return BoundingSphere::FromPoints(m_positions, bounds);
+}
 } // namespace siren::core
@@ -1,5 +1,6 @@
 #pragma once
-#include "renderer/buffer/Buffer.hpp"
+#include "geometry/Bounds.hpp"
+#include "renderer/GeometryArena.hpp"
 #include "renderer/buffer/VertexLayout.hpp"
 
 
@@ -21,8 +22,15 @@ public:
     explicit VertexBufferBuilder(const VertexLayout& layout);
 
     void PushVertex(const CompleteVertex& vertex);
-    Ref<Buffer> Build() const;
+    /// @brief Copies all pushed vertices together with the given indices into the geometry arena
+    /// of the @ref RenderModule.
+    Ref<GeometryAllocation> Build(std::span<const u32> indices) const;
     u32 GetSize() const;
+    /// @brief Returns the bounds of all pushed vertex positions.
+    AABB GetBounds() const;
+    /// @brief Returns a sphere enclosing all pushed vertex positions. bounds must be the result of
+    /// GetBounds(), which is passed in so that the positions are not reduced twice.
+    BoundingSphere GetBoundingSphere(const AABB& bounds) const;
 
 private:
     struct CopyDefinition
@@ -34,6 +42,8 @@ private:
 
     Vector<CopyDefinition> m_copyDefinitions;
     Vector<u8> m_data{ };
+    /// @brief The positions of all vertices, kept separately to compute bounds from.
+    Vector<glm::vec3> m_positions{ };
     VertexLayout m_layout;
     u32 m_count = 0;
 };
@@ -0,0 +1,57 @@
+#include "DrawCommand.hpp"
+
+
+namespace siren::core
+{
+IndirectDrawCounts BuildIndirectDraws(
+    const std::span<const DrawCommand> commands,
+    const std::span<const glm::mat4> transforms,
+    const std::span<glm::mat4> instances,
+    const std::span<DrawElementsIndirectCommand> indirect,
+    const std::span<DrawBatch> batches
+)
+{
+    SirenAssert(
+        instances.size() >= commands.size() && indirect.size() >= commands.size() &&
+        batches.size() >= commands.size(),
+        "Indirect draw outputs must hold one element per command"
+    );
+
+    IndirectDrawCounts counts{ };
+    const DrawCommand* previous = nullptr;
+    for (u32 i = 0; i < commands.size(); i++) {
+        const DrawCommand& cmd = commands[i];
+        if (!cmd) { continue; }
+
+        // packed without gaps, so a run continuing past a skipped command never draws its matrix
+        const u32 instance  = counts.instances++;
+        instances[instance] = transforms[cmd.transformIndex];
+        counts.vertices += cmd.indexCount;
+
+        if (previous && cmd.IsInstanceOf(*previous)) {
+            indirect[counts.indirectDraws - 1].instanceCount++;
+            continue;
+        }
+
+        indirect[counts.indirectDraws] = {
+            .count = cmd.indexCount,
+            .instanceCount = 1,
+            .firstIndex = cmd.firstIndex,
+            .baseVertex = cmd.baseVertex,
+            .baseInstance = instance,
+        };
+
+        if (!previous || !cmd.SharesStateWith(commands[batches[counts.batches - 1].command])) {
+            batches[counts.batches++] = {
+                .command = i,
+                .firstIndirect = counts.indirectDraws,
+                .indirectCount = 0,
+            };
+        }
+        batches[counts.batches - 1].indirectCount++;
+        counts.indirectDraws++;
+        previous = &cmd;
+    }
+    return counts;
+}
+} // namespace siren::core
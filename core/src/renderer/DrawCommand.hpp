@@ -0,0 +1,104 @@
+/**
+ * @file DrawCommand.hpp
+ * @brief Draw commands and their conversion into indirect draws.
+ */
+#pragma once
+
+#include "utilities/spch.hpp"
+
+#include <span>
+
+
+namespace siren::core
+{
+class Buffer;
+class GraphicsPipeline;
+class Material;
+
+/// @brief Struct containing a single draw command. Used for batching draw calls at the end of a
+/// frame.
+struct DrawCommand
+{
+    u32 transformIndex;
+    u32 indexCount;
+    Buffer* vertices;
+    Buffer* indices;
+    GraphicsPipeline* pipeline;
+    Material* material;
+    /// @brief The first index and the value added to each index, for buffers holding more than
+    /// one surface.
+    u32 firstIndex = 0;
+    i32 baseVertex = 0;
+    /// @brief Determines the draw order, see @ref MakeSortKey.
+    u64 sortKey = 0;
+
+    explicit operator bool() const
+    {
+        return indexCount > 0 && vertices && indices && pipeline && material;
+    }
+
+    /// @brief Checks if both commands bind the same state, and can thus be drawn by a single multi
+    /// draw call.
+    bool SharesStateWith(const DrawCommand& other) const
+    {
+        return pipeline == other.pipeline && material == other.material &&
+               vertices == other.vertices && indices == other.indices;
+    }
+
+    /// @brief Checks if both commands draw the same geometry with the same state, and can thus be
+    /// drawn as instances of a single indirect draw.
+    bool IsInstanceOf(const DrawCommand& other) const
+    {
+        return SharesStateWith(other) && indexCount == other.indexCount &&
+               firstIndex == other.firstIndex && baseVertex == other.baseVertex;
+    }
+};
+
+/// @brief The layout OpenGL expects for an indirect indexed draw.
+struct DrawElementsIndirectCommand
+{
+    u32 count;
+    u32 instanceCount;
+    u32 firstIndex;
+    i32 baseVertex;
+    u32 baseInstance;
+};
+
+static_assert(sizeof(DrawElementsIndirectCommand) == 5 * 4);
+
+/// @brief A range of indirect draws sharing the state of a draw command, issued as one multi draw
+/// call.
+struct DrawBatch
+{
+    u32 command;
+    u32 firstIndirect;
+    u32 indirectCount;
+};
+
+/// @brief The amount of elements written by BuildIndirectDraws() and what they draw.
+struct IndirectDrawCounts
+{
+    u32 indirectDraws = 0;
+    u32 batches       = 0;
+    u32 instances     = 0;
+    u32 vertices      = 0;
+};
+
+/**
+ * @brief Merges the sorted commands into indirect draws and batches. Writes the model matrix of
+ * each valid command, taken from transforms, to instances in command order and without gaps, so
+ * that runs of identical commands are instances of one indirect draw starting at the run's first
+ * command. Invalid commands are skipped and write no matrix.
+ *
+ * instances, indirect and batches must hold at least commands.size() elements, as at worst every
+ * command becomes its own indirect draw and batch. Does not touch the graphics API, the outputs may
+ * point to mapped GPU memory.
+ */
+IndirectDrawCounts BuildIndirectDraws(
+    std::span<const DrawCommand> commands,
+    std::span<const glm::mat4> transforms,
+    std::span<glm::mat4> instances,
+    std::span<DrawElementsIndirectCommand> indirect,
+    std::span<DrawBatch> batches
+);
+} // namespace siren::core
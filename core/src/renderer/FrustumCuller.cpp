@@ -0,0 +1,99 @@
+#include "FrustumCuller.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define SIREN_CULLING_SSE
+#include <xmmintrin.h>
+#endif
+
+
+namespace siren::core
+{
+u32 FrustumCuller::Add(const AABB& bounds)
+{
+    // a box covering everything representable, which no plane rejects
+    constexpr float HUGE_EXTENT = std::numeric_limits<float>::max();
+    const bool empty            = bounds.IsEmpty();
+    const glm::vec3 center      = empty ? glm::vec3{ 0.f } : bounds.GetCenter();
+    const glm::vec3 extents     = empty ? glm::vec3{ HUGE_EXTENT } : bounds.GetExtents();
+
+    m_centerX.push_back(center.x);
+    m_centerY.push_back(center.y);
+    m_centerZ.push_back(center.z);
+    m_extentX.push_back(extents.x);
+    m_extentY.push_back(extents.y);
+    m_extentZ.push_back(extents.z);
+    return GetSize() - 1;
+}
+
+void FrustumCuller::Clear()
+{
+    m_centerX.clear();
+    m_centerY.clear();
+    m_centerZ.clear();
+    m_extentX.clear();
+    m_extentY.clear();
+    m_extentZ.clear();
+}
+
+void FrustumCuller::Cull(const Frustum& frustum, Vector<u32>& visible) const
+{
+    visible.clear();
+    const u32 size = GetSize();
+    u32 i          = 0;
+
+#ifdef SIREN_CULLING_SSE
+    // a box is outside if it lies behind any plane, i.e. dot(n, c) + d < -dot(|n|, e)
+    for (; i + 4 <= size; i += 4) {
+        const __m128 cx = _mm_loadu_ps(m_centerX.data() + i);
+        const __m128 cy = _mm_loadu_ps(m_centerY.data() + i);
+        const __m128 cz = _mm_loadu_ps(m_centerZ.data() + i);
+        const __m128 ex = _mm_loadu_ps(m_extentX.data() + i);
+        const __m128 ey = _mm_loadu_ps(m_extentY.data() + i);
+        const __m128 ez = _mm_loadu_ps(m_extentZ.data() + i);
+
+        __m128 outside = _mm_setzero_ps();
+        for (const glm::vec4& plane : frustum.planes) {
+            const __m128 nx = _mm_set1_ps(plane.x);
+            const __m128 ny = _mm_set1_ps(plane.y);
+            const __m128 nz = _mm_set1_ps(plane.z);
+
+            const __m128 distance = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(nx, cx), _mm_mul_ps(ny, cy)),
+                _mm_add_ps(_mm_mul_ps(nz, cz), _mm_set1_ps(plane.w))
+            );
+            const __m128 radius = _mm_add_ps(
+                _mm_add_ps(
+                    _mm_mul_ps(_mm_set1_ps(std::abs(plane.x)), ex),
+                    _mm_mul_ps(_mm_set1_ps(std::abs(plane.y)), ey)
+                ),
+                _mm_mul_ps(_mm_set1_ps(std::abs(plane.z)), ez)
+            );
+            const __m128 behind = _mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps());
+            outside             = _mm_or_ps(outside, behind);
+        }
+
+        const int mask = ~_mm_movemask_ps(outside) & 0xF;
+        for (u32 lane = 0; lane < 4; lane++) {
+            if (mask & (1 << lane)) { visible.push_back(i + lane); }
+        }
+    }
+#endif
+
+    for (; i < size; i++) {
+        if (isVisible(frustum, i)) { visible.push_back(i); }
+    }
+}
+
+bool FrustumCuller::isVisible(const Frustum& frustum, const u32 index) const
+{
+    const glm::vec3 center{ m_centerX[index], m_centerY[index], m_centerZ[index] };
+    const glm::vec3 extents{ m_extentX[index], m_extentY[index], m_extentZ[index] };
+    for (const glm::vec4& plane : frustum.planes) {
+        const glm::vec3 normal = glm::vec3{ plane };
+        if (glm::dot(normal, center) + plane.w + glm::dot(glm::abs(normal), extents) < 0.f) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace siren::core
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "geometry/Bounds.hpp"
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief Tests many world space bounds against a @ref Frustum at once. Bounds are stored as
+ * separate arrays of centers and extents per axis, so that four of them are tested against a
+ * plane with a handful of SIMD instructions where supported.
+ *
+ * Does not depend on any graphics API and can be used without a render context.
+ */
+class FrustumCuller
+{
+public:
+    /// @brief Appends bounds and returns their index. Empty bounds are never culled.
+    u32 Add(const AABB& bounds);
+
+    /// @brief Removes all bounds.
+    void Clear();
+
+    /// @brief Returns the amount of bounds added.
+    u32 GetSize() const { return static_cast<u32>(m_centerX.size()); }
+
+    /// @brief Clears visible and fills it with the indices of all bounds intersecting frustum, in
+    /// ascending order.
+    void Cull(const Frustum& frustum, Vector<u32>& visible) const;
+
+private:
+    Vector<float> m_centerX{ };
+    Vector<float> m_centerY{ };
+    Vector<float> m_centerZ{ };
+    Vector<float> m_extentX{ };
+    Vector<float> m_extentY{ };
+    Vector<float> m_extentZ{ };
+
+    /// @brief Tests the bounds at index against all planes.
+    bool isVisible(const Frustum& frustum, u32 index) const;
+};
+} // namespace siren::core
@@ -0,0 +1,293 @@
+#include "GeometryArena.hpp"
+
+#include <bit>
+
+
+namespace siren::core
+{
+static Own<Buffer> createBuffer(const size_t size)
+{
+    return CreateOwn<Buffer>(nullptr, size, BufferUsage::Static);
+}
+
+/// @brief Returns a new buffer of size holding the contents of source.
+static Own<Buffer> copyBuffer(const Buffer& source, const size_t size)
+{
+    Own<Buffer> buffer = createBuffer(size);
+    if (source.GetSize() > 0) {
+        glCopyNamedBufferSubData(
+            source.GetID(),
+            buffer->GetID(),
+            0,
+            0,
+            static_cast<GLsizeiptr>(source.GetSize())
+        );
+    }
+    return buffer;
+}
+
+/// @brief Returns the capacity of a new buffer for size elements, the next power of two within
+/// [min, max], or exactly size if that is larger than max.
+static u32 getPageCapacity(const u32 size, const u32 min, const u32 max)
+{
+    if (size > max) { return size; }
+    return std::clamp(std::bit_ceil(size), min, max);
+}
+
+/// @brief Returns the capacity ranges has to grow to for size more elements to fit, or Nothing if
+/// that would exceed max. At least doubles, so filling up a page only takes a few copies.
+static Maybe<u32> getGrownCapacity(const RangeAllocator& ranges, const u32 size, const u32 max)
+{
+    const u32 capacity = ranges.GetCapacity();
+    if (ranges.GetLargestFree() >= size) { return capacity; }
+    if (u64{ capacity } + size > max) { return Nothing; }
+    return std::min(std::max(capacity * 2, capacity + size), max);
+}
+
+GeometryAllocation::~GeometryAllocation()
+{
+    if (const Ref<GeometryArena> arena = m_arena.lock()) { arena->free(m_id); }
+}
+
+Ref<GeometryAllocation> GeometryArena::Allocate(
+    const std::span<const u8> vertices,
+    const u32 stride,
+    const std::span<const u32> indices
+)
+{
+    SirenAssert(stride > 0 && vertices.size() % stride == 0, "Vertex data does not match stride");
+    const u32 vertexCount = static_cast<u32>(vertices.size() / stride);
+    const u32 indexCount  = static_cast<u32>(indices.size());
+
+    u32 firstVertex = 0;
+    u32 firstIndex  = 0;
+    const u32 page  = findPage(stride, vertexCount, indexCount, firstVertex, firstIndex);
+
+    Page& target = m_pages[page];
+    target.allocationCount++;
+    if (!vertices.empty()) {
+        target.vertices->UpdateRange(vertices.data(), vertices.size(), size_t{ firstVertex } * stride);
+    }
+    if (!indices.empty()) {
+        target.indices->UpdateRange(indices.data(), indices.size_bytes(), size_t{ firstIndex } * sizeof(u32));
+    }
+
+    u32 id;
+    if (m_freeIds.empty()) {
+        id = static_cast<u32>(m_allocations.size());
+        m_allocations.emplace_back();
+    } else {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+    }
+    m_allocations[id] = {
+        .page = page,
+        .firstVertex = firstVertex,
+        .vertexCount = vertexCount,
+        .firstIndex = firstIndex,
+        .indexCount = indexCount,
+    };
+
+    // not CreateRef, the constructor is private
+    return Ref<GeometryAllocation>(new GeometryAllocation(weak_from_this(), id));
+}
+
+GeometryArena::Range GeometryArena::GetRange(const GeometryAllocation& allocation) const
+{
+    const Allocation& data = m_allocations[allocation.m_id];
+    const Page& page       = m_pages[data.page];
+    return {
+        .vertices = page.vertices.get(),
+        .indices = page.indices.get(),
+        .firstIndex = data.firstIndex,
+        .indexCount = data.indexCount,
+        .baseVertex = static_cast<i32>(data.firstVertex),
+    };
+}
+
+void GeometryArena::Defragment()
+{
+    m_retired.clear();
+
+    for (u32 i = 0; i < m_pages.size(); i++) {
+        Page& page = m_pages[i];
+        if (page.stride == 0) { continue; }
+
+        if (page.allocationCount == 0) {
+            page = Page{ };
+            continue;
+        }
+
+        // only worth the copy once a noticeable part of the page can no longer be handed out
+        const bool fragmented =
+                page.vertexRanges.GetFragmented() > page.vertexRanges.GetCapacity() / 8 ||
+                page.indexRanges.GetFragmented() > page.indexRanges.GetCapacity() / 8;
+        if (fragmented) { compact(i); }
+    }
+}
+
+u32 GeometryArena::GetPageCount() const
+{
+    return static_cast<u32>(
+        std::ranges::count_if(m_pages, [] (const Page& page) { return page.stride != 0; })
+    );
+}
+
+u32 GeometryArena::findPage(
+    const u32 stride,
+    const u32 vertexCount,
+    const u32 indexCount,
+    u32& firstVertex,
+    u32& firstIndex
+)
+{
+    for (u32 i = 0; i < m_pages.size(); i++) {
+        Page& page = m_pages[i];
+        if (page.stride != stride) { continue; }
+
+        const Maybe<u32> vertexOffset = page.vertexRanges.Allocate(vertexCount);
+        if (!vertexOffset) { continue; }
+        const Maybe<u32> indexOffset = page.indexRanges.Allocate(indexCount);
+        if (!indexOffset) {
+            page.vertexRanges.Free(*vertexOffset, vertexCount);
+            continue;
+        }
+
+        firstVertex = *vertexOffset;
+        firstIndex  = *indexOffset;
+        return i;
+    }
+
+    const u32 minVertices = static_cast<u32>(MIN_PAGE_VERTEX_SIZE / stride);
+    const u32 maxVertices = static_cast<u32>(MAX_PAGE_VERTEX_SIZE / stride);
+
+    // no page has room left, grow the first one that stays within the maximum size
+    for (u32 i = 0; i < m_pages.size(); i++) {
+        Page& page = m_pages[i];
+        if (page.stride != stride) { continue; }
+
+        const Maybe<u32> vertexCapacity =
+                getGrownCapacity(page.vertexRanges, vertexCount, maxVertices);
+        const Maybe<u32> indexCapacity =
+                getGrownCapacity(page.indexRanges, indexCount, MAX_PAGE_INDEX_COUNT);
+        if (!vertexCapacity || !indexCapacity) { continue; }
+
+        grow(page, *vertexCapacity, *indexCapacity);
+        firstVertex = *page.vertexRanges.Allocate(vertexCount);
+        firstIndex  = *page.indexRanges.Allocate(indexCount);
+        return i;
+    }
+
+    // sized to the allocation rather than the maximum, geometry larger than that gets a page of its
+    // own
+    const u32 vertexCapacity = getPageCapacity(vertexCount, minVertices, maxVertices);
+    const u32 indexCapacity  =
+            getPageCapacity(indexCount, MIN_PAGE_INDEX_COUNT, MAX_PAGE_INDEX_COUNT);
+
+    Page page;
+    page.stride       = stride;
+    page.vertices     = createBuffer(size_t{ vertexCapacity } * stride);
+    page.indices      = createBuffer(size_t{ indexCapacity } * sizeof(u32));
+    page.vertexRanges = RangeAllocator{ vertexCapacity };
+    page.indexRanges  = RangeAllocator{ indexCapacity };
+    firstVertex       = *page.vertexRanges.Allocate(vertexCount);
+    firstIndex        = *page.indexRanges.Allocate(indexCount);
+
+    // reuse the slot of a released page, allocations only refer to pages by index
+    const auto isReleased = [] (const Page& released) { return released.stride == 0; };
+    const auto released   = std::ranges::find_if(m_pages, isReleased);
+    if (released != m_pages.end()) {
+        *released = std::move(page);
+        return static_cast<u32>(released - m_pages.begin());
+    }
+    m_pages.push_back(std::move(page));
+    return static_cast<u32>(m_pages.size() - 1);
+}
+
+void GeometryArena::grow(Page& page, const u32 vertexCapacity, const u32 indexCapacity)
+{
+    // the replaced buffers are retired rather than destroyed, as ranges handed out this frame may
+    // still refer to them
+    if (vertexCapacity != page.vertexRanges.GetCapacity()) {
+        Own<Buffer> vertices = copyBuffer(*page.vertices, size_t{ vertexCapacity } * page.stride);
+        m_retired.push_back(std::move(page.vertices));
+        page.vertices = std::move(vertices);
+        page.vertexRanges.Grow(vertexCapacity);
+    }
+    if (indexCapacity != page.indexRanges.GetCapacity()) {
+        Own<Buffer> indices = copyBuffer(*page.indices, size_t{ indexCapacity } * sizeof(u32));
+        m_retired.push_back(std::move(page.indices));
+        page.indices = std::move(indices);
+        page.indexRanges.Grow(indexCapacity);
+    }
+}
+
+void GeometryArena::compact(const u32 index)
+{
+    Page& page       = m_pages[index];
+    const u32 stride = page.stride;
+
+    // sized to what is in use, so that a page emptied out shrinks again
+    const u32 vertexCapacity = getPageCapacity(
+        page.vertexRanges.GetUsed(),
+        static_cast<u32>(MIN_PAGE_VERTEX_SIZE / stride),
+        static_cast<u32>(MAX_PAGE_VERTEX_SIZE / stride)
+    );
+    const u32 indexCapacity = getPageCapacity(
+        page.indexRanges.GetUsed(),
+        MIN_PAGE_INDEX_COUNT,
+        MAX_PAGE_INDEX_COUNT
+    );
+
+    // a buffer cannot be copied onto an overlapping range of itself, so everything moves into new
+    // buffers, which the old ones are replaced with
+    Own<Buffer> vertices = createBuffer(size_t{ vertexCapacity } * stride);
+    Own<Buffer> indices  = createBuffer(size_t{ indexCapacity } * sizeof(u32));
+    RangeAllocator vertexRanges{ vertexCapacity };
+    RangeAllocator indexRanges{ indexCapacity };
+
+    for (Allocation& allocation : m_allocations) {
+        if (allocation.page != index) { continue; }
+
+        const u32 firstVertex = *vertexRanges.Allocate(allocation.vertexCount);
+        const u32 firstIndex  = *indexRanges.Allocate(allocation.indexCount);
+        if (allocation.vertexCount > 0) {
+            glCopyNamedBufferSubData(
+                page.vertices->GetID(),
+                vertices->GetID(),
+                static_cast<GLintptr>(allocation.firstVertex) * stride,
+                static_cast<GLintptr>(firstVertex) * stride,
+                static_cast<GLsizeiptr>(allocation.vertexCount) * stride
+            );
+        }
+        if (allocation.indexCount > 0) {
+            glCopyNamedBufferSubData(
+                page.indices->GetID(),
+                indices->GetID(),
+                static_cast<GLintptr>(allocation.firstIndex * sizeof(u32)),
+                static_cast<GLintptr>(firstIndex * sizeof(u32)),
+                static_cast<GLsizeiptr>(allocation.indexCount * sizeof(u32))
+            );
+        }
+        allocation.firstVertex = firstVertex;
+        allocation.firstIndex  = firstIndex;
+    }
+
+    page.vertices     = std::move(vertices);
+    page.indices      = std::move(indices);
+    page.vertexRanges = vertexRanges;
+    page.indexRanges  = indexRanges;
+}
+
+void GeometryArena::free(const u32 id)
+{
+    Allocation& allocation = m_allocations[id];
+    Page& page             = m_pages[allocation.page];
+    page.vertexRanges.Free(allocation.firstVertex, allocation.vertexCount);
+    page.indexRanges.Free(allocation.firstIndex, allocation.indexCount);
+    page.allocationCount--;
+
+    allocation.page = NONE;
+    m_freeIds.push_back(id);
+}
+} // namespace siren::core
@@ -0,0 +1,141 @@
+/**
+ * @file GeometryArena.hpp
+ */
+#pragma once
+
+#include "buffer/Buffer.hpp"
+#include "buffer/RangeAllocator.hpp"
+#include "utilities/spch.hpp"
+
+#include <span>
+
+
+namespace siren::core
+{
+class GeometryArena;
+
+/**
+ * @brief Vertices and indices living in a @ref GeometryArena, freed when destroyed. Where exactly
+ * they live is looked up through the arena, as defragmenting moves them around.
+ */
+class GeometryAllocation
+{
+public:
+    ~GeometryAllocation();
+
+    GeometryAllocation(GeometryAllocation&)            = delete;
+    GeometryAllocation& operator=(GeometryAllocation&) = delete;
+
+    /// @brief Returns the id of this allocation, unique among the live allocations of its arena.
+    u32 GetID() const { return m_id; }
+
+private:
+    friend GeometryArena;
+
+    GeometryAllocation(const Weak<GeometryArena>& arena, const u32 id)
+        : m_arena(arena), m_id(id) { }
+
+    /// @brief Weak, so that allocations outliving the arena do not keep its buffers alive.
+    Weak<GeometryArena> m_arena;
+    u32 m_id;
+};
+
+/**
+ * @brief Packs the geometry of many surfaces into a few large buffers, so that drawing them does
+ * not require rebinding buffers and a whole batch can be drawn by a single multi draw call.
+ *
+ * The buffers are split into pages, each holding a vertex and an index buffer for vertices of a
+ * single stride. Allocations take ranges of both, the indices stay relative to the first vertex of
+ * the allocation and are offset by the base vertex when drawing. Freed ranges are reused and
+ * pages whose free space is scattered are compacted by Defragment().
+ *
+ * Pages start out sized to their first allocation and at least doubling their buffers whenever
+ * they run out of room, up to a maximum size after which further geometry opens a new page. So
+ * a few small meshes only take a few small buffers.
+ */
+class GeometryArena : public std::enable_shared_from_this<GeometryArena>
+{
+public:
+    /// @brief Where an allocation currently lives. Valid until the next Defragment(), buffers
+    /// replaced by growing a page are kept alive until then.
+    struct Range
+    {
+        Buffer* vertices;
+        Buffer* indices;
+        u32 firstIndex;
+        u32 indexCount;
+        i32 baseVertex;
+    };
+
+    /// @brief The smallest size of the vertex buffer of a page in bytes.
+    static constexpr size_t MIN_PAGE_VERTEX_SIZE = 256 * 1024;
+    /// @brief The size in bytes a vertex buffer grows to at most, unless a single allocation
+    /// needs more.
+    static constexpr size_t MAX_PAGE_VERTEX_SIZE = 32 * 1024 * 1024;
+    /// @brief The smallest amount of indices of a page.
+    static constexpr u32 MIN_PAGE_INDEX_COUNT = 64 * 1024;
+    /// @brief The amount of indices an index buffer grows to at most, unless a single allocation
+    /// needs more.
+    static constexpr u32 MAX_PAGE_INDEX_COUNT = 8 * 1024 * 1024;
+
+    /// @brief Copies vertices of the given stride and their indices into the arena.
+    Ref<GeometryAllocation> Allocate(
+        std::span<const u8> vertices,
+        u32 stride,
+        std::span<const u32> indices
+    );
+    /// @brief Returns where allocation currently lives.
+    Range GetRange(const GeometryAllocation& allocation) const;
+
+    /// @brief Compacts pages whose free space is fragmented and releases the buffers of empty
+    /// pages and those replaced by growing pages. Moves allocations, invalidating all previously
+    /// returned ranges.
+    void Defragment();
+
+    /// @brief Returns the amount of pages holding buffers.
+    u32 GetPageCount() const;
+
+private:
+    friend GeometryAllocation;
+
+    struct Page
+    {
+        /// @brief The stride of all vertices in this page, 0 once its buffers have been released.
+        u32 stride = 0;
+        Own<Buffer> vertices;
+        Own<Buffer> indices;
+        RangeAllocator vertexRanges{ 0 };
+        RangeAllocator indexRanges{ 0 };
+        u32 allocationCount = 0;
+    };
+
+    /// @brief Marks freed allocations.
+    static constexpr u32 NONE = ~0u;
+
+    struct Allocation
+    {
+        /// @brief The page holding the allocation, NONE once freed.
+        u32 page;
+        u32 firstVertex;
+        u32 vertexCount;
+        u32 firstIndex;
+        u32 indexCount;
+    };
+
+    Vector<Page> m_pages{ };
+    Vector<Allocation> m_allocations{ };
+    /// @brief Ids of freed allocations, reused before growing m_allocations.
+    Vector<u32> m_freeIds{ };
+    /// @brief Buffers replaced by growing a page, draws of the current frame may still use them.
+    Vector<Own<Buffer>> m_retired{ };
+
+    /// @brief Returns the page that should hold the allocation, growing or creating one if none
+    /// fits.
+    u32 findPage(u32 stride, u32 vertexCount, u32 indexCount, u32& firstVertex, u32& firstIndex);
+    /// @brief Moves the contents of page into larger buffers with the given capacities.
+    void grow(Page& page, u32 vertexCapacity, u32 indexCapacity);
+    /// @brief Moves all allocations of page into fresh, packed buffers sized to its contents.
+    void compact(u32 page);
+    void free(u32 id);
+};
+} // namespace siren::core
@@ -8,7 +8,7 @@
 namespace siren::core
 {
 GraphicsPipeline::GraphicsPipeline(const Properties& properties, const std::string& name) : Asset(name),
-    m_properties(properties), m_vertexArrayID(0)
+    m_properties(properties), m_vertexArrayID(0), m_sortID(s_nextSortID++)
 {
     glCreateVertexArrays(1, &m_vertexArrayID);
 
@@ -111,4 +111,14 @@ u32 GraphicsPipeline::GetVertexArrayID() const
 {
     return m_vertexArrayID;
 }
+
+AlphaMode GraphicsPipeline::GetAlphaMode() const
+{
+    return m_properties.alphaMode;
+}
+
+u32 GraphicsPipeline::GetSortID() const
+{
+    return m_sortID;
+}
 } // namespace siren::core
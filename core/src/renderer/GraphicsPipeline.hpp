@@ -3,6 +3,8 @@
 #include "buffer/VertexLayout.hpp"
 #include "shaders/Shader.hpp"
 
+#include <atomic>
+
 
 namespace siren::core
 {
@@ -66,9 +68,16 @@ public:
 
     u32 GetStride() const;
     u32 GetVertexArrayID() const;
+    AlphaMode GetAlphaMode() const;
+    /// @brief Returns a number identifying this pipeline, assigned in creation order. Used to
+    /// order draws the same way on every run.
+    u32 GetSortID() const;
 
 private:
     Properties m_properties;
     u32 m_vertexArrayID;
+    u32 m_sortID;
+
+    static inline std::atomic<u32> s_nextSortID = 0;
 };
 } // namespace siren::core
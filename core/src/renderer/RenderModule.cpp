@@ -31,6 +31,10 @@ bool RenderModule::Init()
     m_cameraBuffer = CreateOwn<Buffer>(nullptr, sizeof(CameraUBO), BufferUsage::Dynamic);
     m_lightBuffer  = CreateOwn<Buffer>(nullptr, sizeof(LightUBO), BufferUsage::Dynamic);
 
+    // grown on demand
+    m_instanceBuffer = CreateOwn<MappedBuffer>(1024 * sizeof(glm::mat4));
+    m_indirectBuffer = CreateOwn<MappedBuffer>(1024 * sizeof(DrawElementsIndirectCommand));
+
     // load shaders
     {
         m_shaderLibrary.Import("ass://shaders/pbr.sshg", "PBR");
@@ -74,7 +78,8 @@ bool RenderModule::Init()
         m_pipelines.skybox    = CreateRef<GraphicsPipeline>(props, "SkyBox Pipeline");
     }
 
-    m_unitCube = primitive::Generate(CubeParams{ }, m_pipelines.skybox->GetLayout());
+    m_geometryArena = CreateRef<GeometryArena>();
+    m_unitCube      = primitive::Generate(CubeParams{ }, m_pipelines.skybox->GetLayout());
 
     return true;
 }
@@ -93,6 +98,7 @@ void RenderModule::BeginFrame(const RenderInfo& renderInfo)
     cameraUbo.projectionView = renderInfo.cameraInfo.projectionMatrix * renderInfo.cameraInfo.viewMatrix;
     cameraUbo.cameraPosition = renderInfo.cameraInfo.position;
     m_cameraBuffer->Update(&cameraUbo, sizeof(CameraUBO));
+    m_frustum = Frustum::FromMatrix(cameraUbo.projectionView);
     glBindBufferBase(GL_UNIFORM_BUFFER, 0, m_cameraBuffer->GetID());
 
     LightUBO lightUbo;
@@ -109,6 +115,9 @@ void RenderModule::BeginFrame(const RenderInfo& renderInfo)
 
 void RenderModule::EndFrame()
 {
+    // after all passes, so no ranges of this frame are invalidated midway
+    m_geometryArena->Defragment();
+
     // todo: we should really add a SubmitSkybox fn, but that requires a more complex BindMaterial()
 }
 
@@ -130,17 +139,9 @@ void RenderModule::BeginPass(const Ref<FrameBuffer>& frameBuffer, const glm::vec
 
 void RenderModule::EndPass()
 {
-    // todo: sort based on depth here too!
-    std::sort(
-        m_drawQueue.begin(),
-        m_drawQueue.end(),
-        [] (const DrawCommand& left, const DrawCommand& right) {
-            if (left.pipeline != right.pipeline) { // we sort via ptr comparison
-                return left.pipeline < right.pipeline;
-            }
-            return left.material < right.material;
-        }
-    );
+    CullDrawQueue();
+    SortDrawQueue();
+    UploadIndirectDraws();
 
     // todo:
     //      - SubmitSkylight() or something
@@ -152,11 +153,14 @@ void RenderModule::EndPass()
     const GraphicsPipeline* lastPipeline = nullptr;
     const Material* lastMaterial         = nullptr;
 
-    for (const auto& cmd : m_drawQueue) {
-        if (!cmd) { continue; }
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_indirectBuffer->GetID());
+
+    for (const auto& batch : m_batches) {
+        const DrawCommand& cmd = m_drawQueue[batch.command];
 
         if (cmd.pipeline != lastPipeline) {
             cmd.pipeline->Bind();
+            cmd.pipeline->GetShader()->SetUniform("u_instanced", true);
             lastPipeline = cmd.pipeline;
             m_stats.pipelineBinds++;
         }
@@ -166,8 +170,6 @@ void RenderModule::EndPass()
             lastMaterial = cmd.material;
         }
 
-        cmd.pipeline->GetShader()->SetUniform("u_model", m_transforms[cmd.transformIndex]);
-
         const GLenum top = topologyToGlEnum(cmd.pipeline->GetTopology());
 
         if (cmd.vertices != lastVertices) {
@@ -186,13 +188,26 @@ void RenderModule::EndPass()
             lastIndices = cmd.indices;
         }
 
-        glDrawElements(top, cmd.indexCount, GL_UNSIGNED_INT, nullptr);
+        const size_t offset =
+                m_indirectBuffer->GetRegionOffset() + batch.firstIndirect * sizeof(DrawElementsIndirectCommand);
+        glMultiDrawElementsIndirect(
+            top,
+            GL_UNSIGNED_INT,
+            reinterpret_cast<const void*>(offset),
+            static_cast<GLsizei>(batch.indirectCount),
+            0
+        );
         m_stats.drawCalls++;
-        m_stats.vertices += cmd.indexCount;
+    }
+
+    if (!m_drawQueue.empty()) {
+        m_instanceBuffer->Release();
+        m_indirectBuffer->Release();
     }
 
     m_drawQueue.clear();
     m_transforms.clear();
+    m_culler.Clear();
 
     if (m_currentFramebuffer) { m_currentFramebuffer->Unbind(); }
     m_currentFramebuffer = nullptr;
@@ -208,17 +223,36 @@ void RenderModule::SubmitMesh(const Ref<Mesh>& mesh, const glm::mat4& transform)
             return;
         }
 
-        const auto& pipeline = m_pipelines.pbr; // all standard meshes are PBR for now
+        if (!surf.geometry) { continue; }
+
+        const auto& pipeline             = m_pipelines.pbr; // all standard meshes are PBR for now
+        const GeometryArena::Range range = m_geometryArena->GetRange(*surf.geometry);
+
+        const glm::mat4 world  = transform * surf.transform;
+        const AABB bounds      = surf.bounds.Transformed(world);
+        const glm::vec3 center = bounds.IsEmpty() ? glm::vec3{ world[3] } : bounds.GetCenter();
+        const glm::vec3 offset = center - m_renderInfo.cameraInfo.position;
+        const u64 sortKey      = MakeSortKey(
+            pipeline->GetAlphaMode(),
+            pipeline->GetSortID(),
+            material->getSortID(),
+            surf.geometry->GetID(),
+            glm::dot(offset, offset)
+        );
 
-        m_transforms.push_back(transform * surf.transform);
+        m_transforms.push_back(world);
+        m_culler.Add(bounds);
         m_drawQueue.push_back(
             {
                 .transformIndex = static_cast<u32>(m_transforms.size() - 1),
-                .indexCount = surf.indexCount,
-                .vertices = surf.vertices.get(),
-                .indices = surf.indices.get(),
+                .indexCount = range.indexCount,
+                .vertices = range.vertices,
+                .indices = range.indices,
                 .pipeline = pipeline.get(),
                 .material = material.get(),
+                .firstIndex = range.firstIndex,
+                .baseVertex = range.baseVertex,
+                .sortKey = sortKey,
             }
         );
     }
@@ -228,6 +262,8 @@ const RenderStats& RenderModule::GetStats() const { return m_stats; }
 
 Ref<GraphicsPipeline> RenderModule::GetPBRPipeline() const { return m_pipelines.pbr; }
 
+GeometryArena& RenderModule::GetGeometryArena() const { return *m_geometryArena; }
+
 void RenderModule::ReloadShaders() { m_shaderLibrary.ReloadShaders(); }
 
 void RenderModule::BindMaterial(const Material* material, const Shader* shader)
@@ -280,6 +316,64 @@ void RenderModule::BindMaterial(const Material* material, const Shader* shader)
     shader->SetUniform("u_materialFlags", materialFlags);
 }
 
+void RenderModule::CullDrawQueue()
+{
+    m_culler.Cull(m_frustum, m_visible);
+
+    // the culler holds one entry per command in submission order, and the visible indices are
+    // ascending, so the queue can be compacted in place
+    const u32 submitted = static_cast<u32>(m_drawQueue.size());
+    for (u32 i = 0; i < m_visible.size(); i++) { m_drawQueue[i] = m_drawQueue[m_visible[i]]; }
+    m_drawQueue.resize(m_visible.size());
+
+    m_stats.visibleSurfaces += static_cast<u32>(m_visible.size());
+    m_stats.culledSurfaces += submitted - static_cast<u32>(m_visible.size());
+}
+
+void RenderModule::SortDrawQueue()
+{
+    m_sortKeys.clear();
+    for (const auto& cmd : m_drawQueue) { m_sortKeys.push_back(cmd.sortKey); }
+    m_sorter.Sort(m_sortKeys, m_sortOrder);
+
+    // commands are much larger than their keys, so they are only moved once the order is known
+    m_sortedQueue.clear();
+    for (const u32 index : m_sortOrder) { m_sortedQueue.push_back(m_drawQueue[index]); }
+    std::swap(m_drawQueue, m_sortedQueue);
+}
+
+void RenderModule::UploadIndirectDraws()
+{
+    m_batches.clear();
+    if (m_drawQueue.empty()) { return; }
+
+    // at worst every command becomes its own indirect draw
+    const size_t count = m_drawQueue.size();
+    m_instanceBuffer->Reserve(count * sizeof(glm::mat4));
+    m_indirectBuffer->Reserve(count * sizeof(DrawElementsIndirectCommand));
+    m_batches.resize(count);
+
+    const IndirectDrawCounts counts = BuildIndirectDraws(
+        m_drawQueue,
+        m_transforms,
+        { static_cast<glm::mat4*>(m_instanceBuffer->Acquire()), count },
+        { static_cast<DrawElementsIndirectCommand*>(m_indirectBuffer->Acquire()), count },
+        m_batches
+    );
+    m_batches.resize(counts.batches);
+    m_stats.instances += counts.instances;
+    m_stats.vertices += counts.vertices;
+    m_stats.indirectDraws += counts.indirectDraws;
+
+    glBindBufferRange(
+        GL_SHADER_STORAGE_BUFFER,
+        2,
+        m_instanceBuffer->GetID(),
+        static_cast<GLintptr>(m_instanceBuffer->GetRegionOffset()),
+        static_cast<GLsizeiptr>(m_drawQueue.size() * sizeof(glm::mat4))
+    );
+}
+
 void RenderModule::DrawSkyLight()
 {
     if (!m_pipelines.skybox || !m_unitCube || !m_renderInfo.environmentInfo.skybox) { return; }
@@ -293,18 +387,26 @@ void RenderModule::DrawSkyLight()
     const auto view = glm::mat4(glm::mat3(m_renderInfo.cameraInfo.viewMatrix));
     m_pipelines.skybox->GetShader()->SetUniform("u_projectionView", m_renderInfo.cameraInfo.projectionMatrix * view);
 
+    const GeometryArena::Range cube = m_geometryArena->GetRange(*m_unitCube->geometry);
+
     glVertexArrayVertexBuffer(
         m_pipelines.skybox->GetVertexArrayID(),
         0,
-        m_unitCube->vertices->GetID(),
+        cube.vertices->GetID(),
         0,
         m_pipelines.skybox->GetStride()
     );
 
-    glVertexArrayElementBuffer(m_pipelines.skybox->GetVertexArrayID(), m_unitCube->indices->GetID());
+    glVertexArrayElementBuffer(m_pipelines.skybox->GetVertexArrayID(), cube.indices->GetID());
 
-    glDrawElements(GL_TRIANGLES, m_unitCube->indexCount, GL_UNSIGNED_INT, nullptr);
+    glDrawElementsBaseVertex(
+        GL_TRIANGLES,
+        cube.indexCount,
+        GL_UNSIGNED_INT,
+        reinterpret_cast<const void*>(cube.firstIndex * sizeof(u32)),
+        cube.baseVertex
+    );
     m_stats.drawCalls++;
-    m_stats.vertices += m_unitCube->indexCount;
+    m_stats.vertices += cube.indexCount;
 }
 } // namespace siren::core
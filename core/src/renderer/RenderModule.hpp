@@ -1,10 +1,15 @@
 #pragma once
 
 #include "buffer/Buffer.hpp"
+#include "buffer/MappedBuffer.hpp"
 #include "renderer/material/Material.hpp"
+#include "DrawCommand.hpp"
 #include "FrameBuffer.hpp"
+#include "FrustumCuller.hpp"
+#include "GeometryArena.hpp"
 #include "GraphicsPipeline.hpp"
 #include "RenderInfo.hpp"
+#include "RenderSort.hpp"
 #include "core/Module.hpp"
 
 #include "geometry/Mesh.hpp"
@@ -23,16 +28,28 @@ namespace siren::core
 struct RenderStats
 {
     u32 drawCalls     = 0;
+    /// @brief The amount of indirect draws, a single multi draw call issues many.
+    u32 indirectDraws = 0;
+    /// @brief The amount of mesh instances drawn, a single indirect draw draws many.
+    u32 instances     = 0;
     u32 vertices      = 0;
     u32 pipelineBinds = 0;
     u32 textureBinds  = 0;
+    /// @brief The amount of submitted surfaces inside the camera frustum.
+    u32 visibleSurfaces = 0;
+    /// @brief The amount of submitted surfaces skipped by frustum culling.
+    u32 culledSurfaces = 0;
 
     void Reset()
     {
-        drawCalls     = 0;
-        vertices      = 0;
-        pipelineBinds = 0;
-        textureBinds  = 0;
+        drawCalls       = 0;
+        indirectDraws   = 0;
+        instances       = 0;
+        vertices        = 0;
+        pipelineBinds   = 0;
+        textureBinds    = 0;
+        visibleSurfaces = 0;
+        culledSurfaces  = 0;
     }
 };
 
@@ -91,12 +108,21 @@ public:
     const RenderStats& GetStats() const;
     /// @brief Returns the PBR pipeline.
     Ref<GraphicsPipeline> GetPBRPipeline() const;
+    /// @brief Returns the arena holding the geometry of all meshes.
+    GeometryArena& GetGeometryArena() const;
     /// @brief Reloads all core shaders.
     void ReloadShaders();
 
 private:
     void BindMaterial(const Material* material, const Shader* shader);
     void DrawSkyLight();
+    /// @brief Removes all draw commands whose surface lies outside the camera frustum.
+    void CullDrawQueue();
+    /// @brief Orders the draw queue by the sort keys of its commands.
+    void SortDrawQueue();
+    /// @brief Builds the indirect draws and batches of the sorted draw queue into the mapped instance and indirect
+    /// buffers, see @ref BuildIndirectDraws, and binds the instances.
+    void UploadIndirectDraws();
 
     struct // container for pipelines
     {
@@ -106,6 +132,9 @@ private:
         // Ref<GraphicsPipeline> unlit;
     } m_pipelines;
 
+    /// @brief Shared, so that allocations can tell whether it still exists.
+    Ref<GeometryArena> m_geometryArena = nullptr;
+
     Ref<PrimitiveMeshData> m_unitCube;
 
     RenderStats m_stats{ };
@@ -115,23 +144,25 @@ private:
 
     FrameBuffer* m_currentFramebuffer = nullptr;
 
-    Own<Buffer> m_cameraBuffer = nullptr; //< Bound to slot 0 always
-    Own<Buffer> m_lightBuffer  = nullptr; //< Bound to slot 1 always
-
-    /// @brief Struct containing a single draw command. Used for batching draw calls at the end of a frame.
-    struct DrawCommand
-    {
-        u32 transformIndex;
-        u32 indexCount;
-        Buffer* vertices;
-        Buffer* indices;
-        GraphicsPipeline* pipeline;
-        Material* material;
-
-        explicit operator bool() const { return indexCount > 0 && vertices && indices && pipeline && material; }
-    };
+    Own<Buffer> m_cameraBuffer         = nullptr; //< Bound to slot 0 always
+    Own<Buffer> m_lightBuffer          = nullptr; //< Bound to slot 1 always
+    Own<MappedBuffer> m_instanceBuffer = nullptr; //< Bound to storage slot 2 always
+    Own<MappedBuffer> m_indirectBuffer = nullptr;
 
     Vector<DrawCommand> m_drawQueue{ };
     Vector<glm::mat4> m_transforms{ };
+
+    Frustum m_frustum{ };
+    /// @brief The world space bounds of each draw command, in submission order.
+    FrustumCuller m_culler{ };
+    /// @brief Reused output of the culler.
+    Vector<u32> m_visible{ };
+    Vector<DrawBatch> m_batches{ };
+
+    RadixSorter m_sorter{ };
+    /// @brief Reused when sorting the draw queue.
+    Vector<u64> m_sortKeys{ };
+    Vector<u32> m_sortOrder{ };
+    Vector<DrawCommand> m_sortedQueue{ };
 };
 } // namespace siren::core
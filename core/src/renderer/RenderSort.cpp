@@ -0,0 +1,76 @@
+#include "RenderSort.hpp"
+
+
+namespace siren::core
+{
+u64 MakeSortKey(
+    const AlphaMode alphaMode,
+    const u32 pipelineID,
+    const u32 materialID,
+    const u32 geometryID,
+    const float depth
+)
+{
+    // the bits of non-negative floats order like the floats themselves, !(x > 0) also catches NaN
+    const u64 depthBits = std::bit_cast<u32>(!(depth > 0.f) ? 0.f : depth);
+    const u64 pipeline  = pipelineID & 0x3FF;
+    const u64 material  = materialID & 0xFFFFF;
+
+    if (alphaMode == AlphaMode::Blend) {
+        const u64 inverseDepth = ~depthBits & 0xFFFFFFFF;
+        return 1ull << 62 | inverseDepth << 30 | pipeline << 20 | material;
+    }
+
+    // the sign bit is always clear, this keeps the exponent and the 4 highest mantissa bits, so
+    // depths only tie when within about 1/16th of each other
+    const u64 geometry    = geometryID & 0xFFFFF;
+    const u64 coarseDepth = depthBits >> 19;
+    return pipeline << 52 | material << 32 | geometry << 12 | coarseDepth;
+}
+
+void RadixSorter::Sort(const std::span<const u64> keys, Vector<u32>& order)
+{
+    constexpr u32 DIGIT_BITS  = 8;
+    constexpr u32 DIGIT_COUNT = 64 / DIGIT_BITS;
+    constexpr u32 BUCKETS     = 1 << DIGIT_BITS;
+
+    const size_t size = keys.size();
+    order.resize(size);
+    for (u32 i = 0; i < size; i++) { order[i] = i; }
+    if (size < 2) { return; }
+
+    m_keys.assign(keys.begin(), keys.end());
+    m_keyScratch.resize(size);
+    m_indexScratch.resize(size);
+
+    // the histograms of all digits in a single read
+    Array<Array<u32, BUCKETS>, DIGIT_COUNT> counts{ };
+    for (const u64 key : m_keys) {
+        for (u32 digit = 0; digit < DIGIT_COUNT; digit++) {
+            counts[digit][(key >> digit * DIGIT_BITS) & (BUCKETS - 1)]++;
+        }
+    }
+
+    for (u32 digit = 0; digit < DIGIT_COUNT; digit++) {
+        const u32 shift = digit * DIGIT_BITS;
+        auto& count     = counts[digit];
+        // all keys share this digit, the pass would not move anything
+        if (count[(m_keys[0] >> shift) & (BUCKETS - 1)] == size) { continue; }
+
+        u32 offset = 0;
+        for (u32& bucket : count) {
+            const u32 bucketSize = bucket;
+            bucket               = offset;
+            offset += bucketSize;
+        }
+
+        for (size_t i = 0; i < size; i++) {
+            const u32 target       = count[(m_keys[i] >> shift) & (BUCKETS - 1)]++;
+            m_keyScratch[target]   = m_keys[i];
+            m_indexScratch[target] = order[i];
+        }
+        std::swap(m_keys, m_keyScratch);
+        std::swap(order, m_indexScratch);
+    }
+}
+} // namespace siren::core
@@ -0,0 +1,59 @@
+/**
+ * @file RenderSort.hpp
+ * @brief Sort keys for draw commands and the sort ordering them.
+ */
+#pragma once
+
+#include "GraphicsPipeline.hpp"
+#include "utilities/spch.hpp"
+
+#include <span>
+
+
+namespace siren::core
+{
+/**
+ * @brief Packs the state of a draw into a key, so that sorting keys ascending yields the draw
+ * order. Opaque draws come first, grouped by pipeline, then by material, then by geometry, so that
+ * draws of the same mesh end up next to each other and can be instanced. Only within those groups
+ * are they ordered front to back, by a coarsened depth, to reduce overdraw. Blended draws follow
+ * strictly back to front, as required for correct blending, with their state only breaking ties.
+ * From the most significant bit on:
+ *
+ * - opaque: layer 0 (2 bits), pipeline (10), material (20), geometry (20), coarse depth (12)
+ * - blend: layer 1 (2 bits), inverted depth (32), pipeline (10), material (20)
+ *
+ * Ids wider than their field wrap around, which only affects how well draws are grouped.
+ *
+ * @param geometryID Identifies the drawn vertices and indices, such as the id of their
+ * @ref GeometryAllocation.
+ * @param depth The distance of the draw from the camera, any monotonic measure such as the
+ * squared distance works. Negative depths are treated as 0.
+ */
+u64 MakeSortKey(
+    AlphaMode alphaMode,
+    u32 pipelineID,
+    u32 materialID,
+    u32 geometryID,
+    float depth
+);
+
+/**
+ * @brief Orders keys with a least significant digit radix sort, 8 bits per pass. Keys are sorted
+ * together with their indices, so that the sorted order can be applied to larger records
+ * afterwards. Passes over digits that are equal in all keys are skipped, which for typical keys
+ * skips most of the pipeline and material bits. The sort is stable.
+ */
+class RadixSorter
+{
+public:
+    /// @brief Fills order with the indices of keys in ascending key order.
+    void Sort(std::span<const u64> keys, Vector<u32>& order);
+
+private:
+    /// @brief Reused between sorts, the keys and indices ping-pong between these.
+    Vector<u64> m_keys{ };
+    Vector<u64> m_keyScratch{ };
+    Vector<u32> m_indexScratch{ };
+};
+} // namespace siren::core
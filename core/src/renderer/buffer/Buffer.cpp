@@ -33,4 +33,10 @@ void Buffer::Update(const void* data, const size_t size)
     glNamedBufferSubData(m_id, 0, size, data);
     m_size = size;
 }
+
+void Buffer::UpdateRange(const void* data, const size_t size, const size_t offset)
+{
+    SirenAssert(offset + size <= m_size, "Buffer range update out of bounds");
+    glNamedBufferSubData(m_id, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+}
 } // namespace siren::core
@@ -46,6 +46,9 @@ public:
     size_t GetSize() const;
     /// @brief Updates this buffers data
     void Update(const void* data, size_t size);
+    /// @brief Overwrites size bytes of this buffers data starting at offset. Does not grow the
+    /// buffer, the range must lie within it.
+    void UpdateRange(const void* data, size_t size, size_t offset);
 
 private:
     u32 m_id;
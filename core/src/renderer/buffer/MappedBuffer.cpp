@@ -0,0 +1,95 @@
+#include "MappedBuffer.hpp"
+
+
+namespace siren::core
+{
+/// @brief Regions are rounded up to this, so their offsets satisfy any buffer offset alignment.
+static constexpr size_t REGION_ALIGNMENT = 256;
+
+MappedBuffer::MappedBuffer(const size_t regionSize)
+{
+    create(regionSize);
+}
+
+MappedBuffer::~MappedBuffer()
+{
+    destroy();
+}
+
+u32 MappedBuffer::GetID() const
+{
+    return m_id;
+}
+
+size_t MappedBuffer::GetRegionSize() const
+{
+    return m_regionSize;
+}
+
+size_t MappedBuffer::GetRegionOffset() const
+{
+    return m_region * m_regionSize;
+}
+
+void MappedBuffer::Reserve(const size_t size)
+{
+    if (size <= m_regionSize) { return; }
+
+    size_t regionSize = m_regionSize;
+    while (regionSize < size) { regionSize *= 2; }
+    // deleting a buffer the GPU still reads from is safe, it lives on until the GPU is done with it
+    destroy();
+    create(regionSize);
+}
+
+void* MappedBuffer::Acquire()
+{
+    m_region = (m_region + 1) % REGION_COUNT;
+
+    // the region was usually released frames ago, so this rarely has to wait
+    if (GLsync& fence = m_fences[m_region]) {
+        GLenum result;
+        do {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000);
+        } while (result == GL_TIMEOUT_EXPIRED);
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    return m_data + GetRegionOffset();
+}
+
+void MappedBuffer::Release()
+{
+    GLsync& fence = m_fences[m_region];
+    if (fence) { glDeleteSync(fence); }
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void MappedBuffer::create(const size_t regionSize)
+{
+    SirenAssert(regionSize > 0, "Cannot create an empty buffer");
+    m_regionSize = (regionSize + REGION_ALIGNMENT - 1) / REGION_ALIGNMENT * REGION_ALIGNMENT;
+    m_region     = 0;
+
+    constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    const size_t size          = m_regionSize * REGION_COUNT;
+    glCreateBuffers(1, &m_id);
+    glNamedBufferStorage(m_id, static_cast<GLsizeiptr>(size), nullptr, flags);
+    void* data = glMapNamedBufferRange(m_id, 0, static_cast<GLsizeiptr>(size), flags);
+    m_data     = static_cast<std::byte*>(data);
+    SirenAssert(m_data, "Failed to map buffer");
+}
+
+void MappedBuffer::destroy()
+{
+    for (GLsync& fence : m_fences) {
+        if (fence) { glDeleteSync(fence); }
+        fence = nullptr;
+    }
+    glUnmapNamedBuffer(m_id);
+    glDeleteBuffers(1, &m_id);
+    m_id   = 0;
+    m_data = nullptr;
+}
+} // namespace siren::core
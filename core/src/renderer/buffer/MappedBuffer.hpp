@@ -0,0 +1,56 @@
+/**
+ * @file MappedBuffer.hpp
+ */
+#pragma once
+
+#include "utilities/spch.hpp"
+#include "platform/GL.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief A chunk of GPU memory that stays mapped for its whole lifetime, so the CPU writes into it
+ * directly instead of uploading data. It is split into one region per frame in flight, each guarded
+ * by a fence, so that the CPU never overwrites data the GPU is still reading.
+ */
+class MappedBuffer
+{
+public:
+    /// @brief The amount of regions, i.e. how far the CPU may run ahead of the GPU.
+    static constexpr u32 REGION_COUNT = 3;
+
+    /// @brief Creates and maps a buffer with room for regionSize bytes per region.
+    explicit MappedBuffer(size_t regionSize);
+    ~MappedBuffer();
+
+    MappedBuffer(MappedBuffer&)            = delete;
+    MappedBuffer& operator=(MappedBuffer&) = delete;
+
+    /// @brief Returns this MappedBuffer's ID.
+    u32 GetID() const;
+    /// @brief Returns the size of a single region.
+    size_t GetRegionSize() const;
+    /// @brief Returns the byte offset of the current region within the buffer.
+    size_t GetRegionOffset() const;
+
+    /// @brief Makes sure a region holds at least size bytes. Growing replaces the buffer, which
+    /// changes its ID and discards its contents.
+    void Reserve(size_t size);
+    /// @brief Moves on to the next region, waiting until the GPU is done reading it, and returns a
+    /// pointer to its memory.
+    void* Acquire();
+    /// @brief Fences the current region. Must be called after the last command reading it.
+    void Release();
+
+private:
+    u32 m_id            = 0;
+    size_t m_regionSize = 0;
+    std::byte* m_data   = nullptr;
+    u32 m_region        = 0;
+    Array<GLsync, REGION_COUNT> m_fences{ };
+
+    void create(size_t regionSize);
+    void destroy();
+};
+} // namespace siren::core
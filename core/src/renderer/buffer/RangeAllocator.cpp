@@ -0,0 +1,92 @@
+#include "RangeAllocator.hpp"
+
+
+namespace siren::core
+{
+RangeAllocator::RangeAllocator(const u32 capacity) : m_capacity(capacity)
+{
+    if (capacity > 0) { m_free.push_back({ .offset = 0, .size = capacity }); }
+}
+
+Maybe<u32> RangeAllocator::Allocate(const u32 size)
+{
+    if (size == 0) { return 0; }
+
+    for (auto it = m_free.begin(); it != m_free.end(); ++it) {
+        if (it->size < size) { continue; }
+
+        const u32 offset = it->offset;
+        it->offset += size;
+        it->size -= size;
+        if (it->size == 0) { m_free.erase(it); }
+        m_used += size;
+        return offset;
+    }
+
+    return Nothing;
+}
+
+void RangeAllocator::Free(const u32 offset, const u32 size)
+{
+    if (size == 0) { return; }
+    SirenAssert(
+        offset + size <= m_capacity && size <= m_used,
+        "Freeing a range that was never allocated"
+    );
+
+    const auto next = std::ranges::lower_bound(m_free, offset, { }, &Block::offset);
+    m_used -= size;
+
+    // merge with the free neighbours where they touch the freed range
+    const auto previous      = next != m_free.begin() ? std::prev(next) : m_free.end();
+    const bool mergePrevious = previous != m_free.end() && previous->offset + previous->size == offset;
+    const bool mergeNext     = next != m_free.end() && offset + size == next->offset;
+
+    if (mergePrevious && mergeNext) {
+        previous->size += size + next->size;
+        m_free.erase(next);
+    } else if (mergePrevious) {
+        previous->size += size;
+    } else if (mergeNext) {
+        next->offset = offset;
+        next->size += size;
+    } else {
+        m_free.insert(next, { .offset = offset, .size = size });
+    }
+}
+
+void RangeAllocator::Grow(const u32 capacity)
+{
+    if (capacity <= m_capacity) { return; }
+
+    const u32 added = capacity - m_capacity;
+    if (!m_free.empty() && m_free.back().offset + m_free.back().size == m_capacity) {
+        m_free.back().size += added;
+    } else {
+        m_free.push_back({ .offset = m_capacity, .size = added });
+    }
+    m_capacity = capacity;
+}
+
+u32 RangeAllocator::GetCapacity() const
+{
+    return m_capacity;
+}
+
+u32 RangeAllocator::GetUsed() const
+{
+    return m_used;
+}
+
+u32 RangeAllocator::GetLargestFree() const
+{
+    u32 largest = 0;
+    for (const Block& block : m_free) { largest = std::max(largest, block.size); }
+    return largest;
+}
+
+u32 RangeAllocator::GetFragmented() const
+{
+    return m_capacity - m_used - GetLargestFree();
+}
+} // namespace siren::core
@@ -0,0 +1,50 @@
+/**
+ * @file RangeAllocator.hpp
+ */
+#pragma once
+
+#include "utilities/spch.hpp"
+
+
+namespace siren::core
+{
+/**
+ * @brief Hands out ranges of a fixed capacity, such as the elements of a buffer. Only offsets are
+ * tracked, no memory is touched. Free ranges are kept sorted by offset, allocations take the first
+ * one large enough and freed ranges merge with their free neighbours.
+ */
+class RangeAllocator
+{
+public:
+    explicit RangeAllocator(u32 capacity);
+
+    /// @brief Returns the offset of a new range of size, or Nothing if no free range is large
+    /// enough.
+    Maybe<u32> Allocate(u32 size);
+    /// @brief Frees the range at offset, which must have been allocated with size.
+    void Free(u32 offset, u32 size);
+    /// @brief Raises the capacity, the added elements are free and extend a free range ending at
+    /// the previous capacity.
+    void Grow(u32 capacity);
+
+    u32 GetCapacity() const;
+    /// @brief Returns the amount of allocated elements.
+    u32 GetUsed() const;
+    /// @brief Returns the size of the largest free range, i.e. of the largest possible allocation.
+    u32 GetLargestFree() const;
+    /// @brief Returns the amount of free elements outside the largest free range, i.e. those that
+    /// can only be handed out to allocations smaller than the largest one possible.
+    u32 GetFragmented() const;
+
+private:
+    struct Block
+    {
+        u32 offset;
+        u32 size;
+    };
+
+    Vector<Block> m_free{ };
+    u32 m_capacity;
+    u32 m_used = 0;
+};
+} // namespace siren::core
@@ -8,6 +8,8 @@
 #include "renderer/Texture.hpp"
 #include "utilities/spch.hpp"
 
+#include <atomic>
+
 
 namespace siren::core
 {
@@ -40,6 +42,9 @@ struct Material final : Asset
     MaterialKey getMaterialKey() const;
     /// @brief Invalidates this material's @ref MaterialKey. Used when updating uniforms.
     void invalidateMaterialKey() const;
+    /// @brief Returns a number identifying this material, assigned in creation order. Used to
+    /// order draws the same way on every run.
+    u32 getSortID() const { return m_sortID; }
 
     /// @brief Checks whether this material has the given @ref TextureType.
     bool hasTexture(TextureRole type) const;
@@ -70,5 +75,9 @@ private:
 
     /// @brief A cached material key.
     mutable Maybe<MaterialKey> m_materialKey = Nothing;
+
+    /// @brief Atomic, as materials are created by importers on any thread.
+    static inline std::atomic<u32> s_nextSortID = 0;
+    u32 m_sortID                                = s_nextSortID++;
 };
 } // namespace siren::core
@@ -28,52 +28,56 @@ public:
 
 protected:
     template <typename T>
-        requires(std::derived_from<T, Component>)
+        requires(ComponentType<T>)
     T& get() const
     {
         return scene->get<T>(entityHandle);
     }
 
     template <typename T>
-        requires(std::derived_from<T, Component>)
+        requires(ComponentType<T>)
     T* getSafe() const
     {
         return scene->GetSafe<T>(entityHandle);
     }
 
     template <typename T>
-        requires(std::derived_from<T, Component>)
+        requires(ComponentType<T>)
     T& getSingleton() const
     {
         return scene->GetSingleton<T>();
     }
 
     template <typename T>
-        requires(std::derived_from<T, Component>)
+        requires(ComponentType<T>)
     T* getSingletonSafe() const
     {
         return scene->GetSingletonSafe<T>();
     }
 
+    /// @brief Adds a component to this entity. The change is recorded into the scene's
+    /// @ref CommandBuffer and applied at the end of the current phase, the returned reference is
+    /// only valid until then.
     template <typename T, typename... Args>
-        requires(std::derived_from<T, Component>)
+        requires(ComponentType<T>)
     T& emplace(Args&&... args)
     {
-        return scene->Emplace<T>(entityHandle, std::forward<Args>(args)...);
+        return scene->Commands().emplace<T>(entityHandle, std::forward<Args>(args)...);
     }
 
+    /// @brief Removes a component from this entity at the end of the current phase.
     template <typename T>
-        requires(std::derived_from<T, Component>)
-    T& remove()
+        requires(ComponentType<T>)
+    void remove()
     {
-        return scene->remove<T>(entityHandle);
+        scene->Commands().remove<T>(entityHandle);
     }
 
 private:
     // XXX: should these be private? make just expose getters to inheritors? or a large set of
     // predefined functions? since providing scene directly seems dangerous maybe
 
-    EntityHandle entityHandle = utilities::UUID::invalid();
+    EntityHandle entityHandle = EntityHandle::invalid();
     Scene* scene              = nullptr;
 };
 } // namespace siren::script
@@ -72,7 +72,8 @@ void EditorApp::setupEditor()
 
         const core::EntityHandle skybox = scene.Create();
         SirenAssert(skyBoxRes, "SkyBox Import failed");
-        rcc.skyBoxComponent = &scene.Emplace<core::SkyLightComponent>(skybox, skyBoxRes);
+        scene.Emplace<core::SkyLightComponent>(skybox, skyBoxRes);
+        rcc.skyBox = skybox;
 
         // todo: load scene from scene file
     }
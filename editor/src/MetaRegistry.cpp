@@ -60,27 +60,27 @@ void MetaRegistry::registerComponents()
 {
     // todo: camera components
 
-    reflect<core::DirectionalLightComponent>("DirectionalLightComponent")
+    reflectComponent<core::DirectionalLightComponent>("DirectionalLightComponent")
             .data<&core::DirectionalLightComponent::color>("color")
             .custom<GuiMeta>(GuiMeta::color())
             .data<&core::DirectionalLightComponent::direction>("direction")
             .custom<GuiMeta>(GuiMeta::drag());
 
-    reflect<core::MeshComponent>("MeshComponent")
+    reflectComponent<core::MeshComponent>("MeshComponent")
             .data<&core::MeshComponent::meshHandle>("meshHandle")
             .custom<GuiMeta>(GuiMeta::none());
 
-    reflect<core::PointLightComponent>("PointLightComponent")
+    reflectComponent<core::PointLightComponent>("PointLightComponent")
             .data<&core::PointLightComponent::color>("color")
             .custom<GuiMeta>(GuiMeta::color())
             .data<&core::PointLightComponent::position>("position")
             .custom<GuiMeta>(GuiMeta::drag());
 
-    reflect<core::SkyLightComponent>("SkyLightComponent")
+    reflectComponent<core::SkyLightComponent>("SkyLightComponent")
             .data<&core::SkyLightComponent::cubeMapHandle>("cubeMapHandle")
             .custom<GuiMeta>(GuiMeta::none());
 
-    reflect<core::SpotLightComponent>("SpotLightComponent")
+    reflectComponent<core::SpotLightComponent>("SpotLightComponent")
             .data<&core::SpotLightComponent::innerCone>("innerCone")
             .custom<GuiMeta>(GuiMeta::drag(0.1f, 0.f, 50.f))
             .data<&core::SpotLightComponent::outerCone>("outerCone")
@@ -90,12 +90,16 @@ void MetaRegistry::registerComponents()
             .data<&core::SpotLightComponent::position>("position")
             .custom<GuiMeta>(GuiMeta::drag());
 
-    reflect<core::TransformComponent>("TransformComponent")
-            .data<&core::TransformComponent::rotation>("rotation")
+    reflectComponent<core::TransformComponent>("TransformComponent")
+            .data<&core::TransformComponent::SetEulerAngles, &core::TransformComponent::GetEulerAngles>(
+                "rotation"
+            )
             .custom<GuiMeta>(GuiMeta::drag(0.02, 0, glm::pi<float>()))
-            .data<&core::TransformComponent::scale>("scale")
+            .data<&core::TransformComponent::SetScale, &core::TransformComponent::GetScale>("scale")
             .custom<GuiMeta>(GuiMeta::drag())
-            .data<&core::TransformComponent::translation>("translation")
+            .data<&core::TransformComponent::SetTranslation, &core::TransformComponent::GetTranslation>(
+                "translation"
+            )
             .custom<GuiMeta>(GuiMeta::drag());
 }
 } // siren::editor
@@ -1,7 +1,6 @@
 #pragma once
 #include "entt.hpp"
 
-#include "ecs/core/Component.hpp"
 #include "ecs/core/Scene.hpp"
 
 // todo: better init system
@@ -27,13 +26,12 @@ public:
         return i;
     }
 
+    /// @brief Reflects the component type T and makes it available in the inspector.
     template <typename T>
-        requires (std::derived_from<T, core::Component>)
-    entt::meta_factory<T> reflect(const char* name)
+        requires (core::ComponentType<T>)
+    entt::meta_factory<T> reflectComponent(const char* name)
     {
-        const auto factory = entt::meta_factory<T>()
-                             .type(name)
-                             .template base<core::Component>();
+        const auto factory = reflect<T>(name);
 
         const entt::meta_type t = entt::resolve<T>();
 
@@ -53,7 +51,6 @@ public:
     }
 
     template <typename T>
-        requires (!std::derived_from<T, core::Component>)
     entt::meta_factory<T> reflect(const char* name)
     {
         return entt::meta_factory<T>()
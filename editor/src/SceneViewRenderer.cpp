@@ -40,7 +40,7 @@ void SceneViewRenderer::render(
     // setup lights
     {
         i32 lightCount = 0;
-        for (const auto& lightEntity : scene.GetWith<core::PointLightComponent>()) {
+        for (const auto& lightEntity : scene.Query<core::PointLightComponent>()) {
             if (lightCount >= 16) {
                 wrn("There are more than 16 PointLight's in the current scene, cannot render them all.");
                 break;
@@ -55,7 +55,7 @@ void SceneViewRenderer::render(
         }
         lightInfo.pointLightCount = lightCount;
         lightCount                = 0;
-        for (const auto& lightEntity : scene.GetWith<core::DirectionalLightComponent>()) {
+        for (const auto& lightEntity : scene.Query<core::DirectionalLightComponent>()) {
             if (lightCount >= 16) {
                 wrn("There are more than 16 DirectionalLight's in the current scene, cannot render them all.");
                 break;
@@ -70,7 +70,7 @@ void SceneViewRenderer::render(
         }
         lightInfo.directionalLightCount = lightCount;
         lightCount                      = 0;
-        for (const auto& lightEntity : scene.GetWith<core::SpotLightComponent>()) {
+        for (const auto& lightEntity : scene.Query<core::SpotLightComponent>()) {
             if (lightCount >= 16) {
                 wrn("There are more than 16 SpotLight's in the current scene, cannot render them all.");
                 break;
@@ -92,8 +92,9 @@ void SceneViewRenderer::render(
     // setup environment
     {
         const auto rcc = scene.GetSingletonSafe<core::RenderContextComponent>();
-        if (rcc && rcc->skyBoxComponent) {
-            const auto cubeMap = am.GetAsset<core::TextureCubeMap>(rcc->skyBoxComponent->cubeMapHandle);
+        const auto skyBox = rcc ? scene.GetSafe<core::SkyLightComponent>(rcc->skyBox) : nullptr;
+        if (skyBox) {
+            const auto cubeMap = am.GetAsset<core::TextureCubeMap>(skyBox->cubeMapHandle);
             if (cubeMap) {
                 envInfo.skybox = cubeMap;
             } else {
@@ -107,7 +108,7 @@ void SceneViewRenderer::render(
     renderer.BeginPass(frameBuffer, glm::vec4{ 0.14, 0.14, 0.14, 1 });
 
     // iterate over all drawable entities
-    for (const auto& e : scene.GetWith<core::MeshComponent, core::TransformComponent>()) {
+    for (const auto& e : scene.Query<core::MeshComponent, core::TransformComponent>()) {
         const auto* meshComponent      = scene.GetSafe<core::MeshComponent>(e);
         const auto* transformComponent = scene.GetSafe<core::TransformComponent>(e);
 
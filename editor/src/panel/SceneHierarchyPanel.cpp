@@ -59,18 +59,7 @@ void SceneHierarchyPanel::drawToolbar()
 
 void SceneHierarchyPanel::drawPanel()
 {
-    auto& scene = m_state->scene;
-
-    // fixme: this sorting is kinda dumb lol "10" < "2"
-    auto entities = scene.GetWith<core::HierarchyComponent>();
-    std::ranges::sort(
-        entities,
-        [&scene] (const core::EntityHandle e1, const core::EntityHandle e2) {
-            const auto tag1 = scene.GetSafe<core::TagComponent>(e1);
-            const auto tag2 = scene.GetSafe<core::TagComponent>(e2);
-            return (tag1 ? tag1->tag : "") < (tag2 ? tag2->tag : "");
-        }
-    );
+    const auto& hierarchy = m_state->scene.GetHierarchy();
 
     if (shouldDeselect()) {
         if (m_renaming) {
@@ -80,30 +69,42 @@ void SceneHierarchyPanel::drawPanel()
         }
     }
 
-    for (const auto& entity : entities) {
-        const auto hierarchy = scene.GetSafe<core::HierarchyComponent>(entity);
-        if (!hierarchy || hierarchy->parent) { continue; }
+    // the hierarchy is stored depth first, so the tree is drawn in a single pass. Collapsed nodes
+    // skip their whole subtree, open nodes are popped once their subtree has been drawn.
+    m_openSubtreeEnds.clear();
+    u32 index = 0;
+    while (index < hierarchy.size()) {
+        while (!m_openSubtreeEnds.empty() && index >= m_openSubtreeEnds.back()) {
+            ImGui::TreePop();
+            m_openSubtreeEnds.pop_back();
+        }
 
-        drawEntity(entity);
+        const u32 subtreeEnd = index + hierarchy[index].size;
+        if (drawEntity(hierarchy[index])) {
+            m_openSubtreeEnds.push_back(subtreeEnd);
+            index++;
+        } else {
+            index = subtreeEnd;
+        }
     }
+    for (size_t i = 0; i < m_openSubtreeEnds.size(); i++) { ImGui::TreePop(); }
 }
 
-void SceneHierarchyPanel::drawEntity(const core::EntityHandle entity)
+bool SceneHierarchyPanel::drawEntity(const core::Hierarchy::Node& node)
 {
     ImGuiSiren::ScopedStyleVarY yPad(ImGuiStyleVar_FramePadding, 4);
 
-    const auto& scene             = m_state->scene;
-    const bool thisEntitySelected = m_state->selectedEntity == entity;
+    const auto& scene               = m_state->scene;
+    const core::EntityHandle entity = node.entity;
+    const bool thisEntitySelected   = m_state->selectedEntity == entity;
     // if we are renaming this entity
     const bool renamingThisEntity = thisEntitySelected && m_renaming;
 
-    const auto& hierarchy = scene.get<core::HierarchyComponent>(entity); // must have this component
-
     ImGuiTreeNodeFlags flags = m_baseNodeFlags;
-    if (hierarchy.children.empty()) { flags |= ImGuiTreeNodeFlags_Leaf; }
+    if (node.size == 1) { flags |= ImGuiTreeNodeFlags_Leaf; }
     if (thisEntitySelected) { flags |= ImGuiTreeNodeFlags_Selected; }
 
-    const bool nodeOpen = ImGui::TreeNodeEx(reinterpret_cast<void*>(entity.id()), flags, "");
+    const bool nodeOpen = ImGui::TreeNodeEx(reinterpret_cast<void*>(static_cast<uintptr_t>(entity.id())), flags, "");
 
     const auto beginRename = [&] {
         m_renameBuffer = getEntityName(scene, entity);
@@ -143,10 +144,7 @@ void SceneHierarchyPanel::drawEntity(const core::EntityHandle entity)
         ImGui::TextUnformatted(getEntityName(scene, entity).c_str());
     }
 
-    if (nodeOpen) {
-        for (const auto& child : hierarchy.children) { drawEntity(child); }
-        ImGui::TreePop();
-    }
+    return nodeOpen;
 }
 
 bool SceneHierarchyPanel::shouldDeselect() const
@@ -161,8 +159,8 @@ core::EntityHandle SceneHierarchyPanel::createEntity()
     auto& scene                     = m_state->scene;
     const core::EntityHandle entity = scene.Create();
     scene.Emplace<core::TagComponent>(entity, "Unnamed");
-    scene.Emplace<core::HierarchyComponent>(entity);
     scene.Emplace<core::TransformComponent>(entity);
+    scene.SetParent(entity); // entities without a parent are the roots of the hierarchy panel
     return entity;
 }
 
@@ -170,26 +168,23 @@ core::EntityHandle SceneHierarchyPanel::addChild(const core::EntityHandle parent
 {
     if (!parent) { return core::EntityHandle::invalid(); }
 
-    const auto& scene              = m_state->scene;
     const core::EntityHandle child = createEntity();
-
-    auto& parentHierarchy = scene.get<core::HierarchyComponent>(parent);
-    auto& childHierarchy  = scene.get<core::HierarchyComponent>(child);
-
-    parentHierarchy.children.push_back(child);
-    childHierarchy.parent = parent;
-
+    m_state->scene.SetParent(child, parent);
     return child;
 }
 
 void SceneHierarchyPanel::deleteEntity(const core::EntityHandle entity)
 {
     auto& scene           = m_state->scene;
-    const auto* hierarchy = scene.GetSafe<core::HierarchyComponent>(entity);
-    if (!hierarchy) { return; }
-    for (const auto& child : hierarchy->children) {
-        deleteEntity(child);
+    const auto& hierarchy = scene.GetHierarchy();
+    const u32 index       = hierarchy.find(entity);
+    if (index == core::Hierarchy::NONE) { return; }
+
+    // the subtree of entity is the contiguous range following it
+    Vector<core::EntityHandle> subtree;
+    for (u32 i = index; i < index + hierarchy[index].size; i++) {
+        subtree.push_back(hierarchy[i].entity);
     }
-    scene.destroy(entity);
+    scene.DestroyMany(subtree);
 }
 } // namespace siren::editor
@@ -25,7 +25,8 @@ private:
 
     void drawToolbar();
     void drawPanel();
-    void drawEntity(core::EntityHandle entity);
+    /// @brief Draws the tree node of a single entity, returns true if the node is open.
+    bool drawEntity(const core::Hierarchy::Node& node);
 
     // Utility Functions
 
@@ -38,6 +39,7 @@ private:
     bool m_renaming                          = false; ///< If an entity is currently being renamed.
     bool m_exitRename                        = false; ///< Indicates if we should stop renaming selected entity.
     std::string m_renameBuffer               = "";    ///< String buffer for entity name
+    Vector<u32> m_openSubtreeEnds{ };                 ///< End index of each open tree node's subtree.
     const ImGuiTreeNodeFlags m_baseNodeFlags =
             ImGuiTreeNodeFlags_OpenOnArrow |
             ImGuiTreeNodeFlags_SpanFullWidth |
@@ -27,12 +27,12 @@ void PlayerController::onUpdate(const float delta)
     if (glm::length(dir) == 0) { return; } // no input, can skip all
 
     dir               = glm::normalize(dir);
-    glm::vec3 forward = transform.rotation * glm::vec3(0, 0, -1);
-    glm::vec3 right   = transform.rotation * glm::vec3(1, 0, 0);
+    glm::vec3 forward = transform.GetRotation() * glm::vec3(0, 0, -1);
+    glm::vec3 right   = transform.GetRotation() * glm::vec3(1, 0, 0);
     glm::vec3 up      = glm::vec3(0, 1, 0);
 
     glm::vec3 move = dir.x * right + dir.y * up + dir.z * forward;
 
-    transform.translation += move * delta * m_movementSpeed;
+    transform.Translate(move * delta * m_movementSpeed);
 }
 } // namespace siren
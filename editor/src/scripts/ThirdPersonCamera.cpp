@@ -32,7 +32,7 @@ void ThirdPersonCamera::onUpdate(const float delta)
     camera.pitch =
             glm::clamp(camera.pitch, -glm::half_pi<float>() + 0.1f, glm::half_pi<float>() - 0.1f);
 
-    const glm::vec3 focalPoint = transform.translation + camera.focalOffset;
+    const glm::vec3 focalPoint = transform.GetTranslation() + camera.focalOffset;
 
     glm::vec3 offset;
     offset.x = camera.distanceOffset * std::cos(camera.pitch) * std::sin(camera.yaw);
@@ -43,10 +43,10 @@ void ThirdPersonCamera::onUpdate(const float delta)
     camera.viewDirection = glm::normalize(focalPoint - camera.position);
 
     const float modelYaw = std::atan2(
-        camera.position.x - transform.translation.x,
-        camera.position.z - transform.translation.z
+        camera.position.x - transform.GetTranslation().x,
+        camera.position.z - transform.GetTranslation().z
     );
-    transform.rotation.y = modelYaw;
+    transform.SetRotation(glm::angleAxis(modelYaw, glm::vec3{ 0, 1, 0 }));
 }
 
 void ThirdPersonCamera::onPause()
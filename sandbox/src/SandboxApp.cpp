@@ -11,11 +11,14 @@
 #include "ecs/components/PointLightComponent.hpp"
 #include "ecs/components/RenderContextComponent.hpp"
 #include "ecs/components/ScriptContainerComponent.hpp"
+#include "ecs/components/SkyLightComponent.hpp"
 #include "ecs/components/TransformComponent.hpp"
 #include "ecs/core/SceneImpl.tpp"
 #include "ecs/core/Scene.hpp"
 #include "ecs/systems/RenderSystem.hpp"
 #include "ecs/systems/ScriptSystem.hpp"
+#include "ecs/systems/SpatialIndexSystem.hpp"
+#include "ecs/systems/TransformSystem.hpp"
 
 #include "events/Events.hpp"
 
@@ -43,19 +46,18 @@ void SandboxApp::Init()
         m_scene.Emplace<core::TransformComponent>(e);
         m_scene.bind<editor::PlayerController>(e);
         m_scene.bind<editor::ThirdPersonCamera>(e);
-        m_scene.emplaceSingleton<core::RenderContextComponent>(
-            &m_scene.Emplace<core::ThirdPersonCameraComponent>(e, dim.x, dim.y)
-        );
+        m_scene.Emplace<core::ThirdPersonCameraComponent>(e, dim.x, dim.y);
+        m_scene.emplaceSingleton<core::RenderContextComponent>(e);
     }
 
     // skybox
     {
         const auto e      = m_scene.Create();
         const auto handle = core::Assets().Import("ass://cubemaps/skybox/sky.cube");
-        auto& skylight    = m_scene.Emplace<core::SkyLightComponent>(e, handle);
+        m_scene.Emplace<core::SkyLightComponent>(e, handle);
 
-        auto& rcc           = m_scene.GetSingleton<core::RenderContextComponent>();
-        rcc.skyBoxComponent = &skylight;
+        auto& rcc  = m_scene.GetSingleton<core::RenderContextComponent>();
+        rcc.skyBox = e;
     }
 
     // setup environment entity
@@ -71,22 +73,29 @@ void SandboxApp::Init()
 
     // add lights
     if constexpr (true) {
+        auto& am                = core::Assets();
+        const auto lightPrefab  = am.GetAsset<core::Prefab>(am.CreatePrefab("Point Light"));
+        lightPrefab->Set<core::TransformComponent>();
+        lightPrefab->Set<core::PointLightComponent>();
+
+        const auto lights = m_scene.Instantiate(*lightPrefab, 5);
         for (i32 i = 0; i < 5; i++) {
-            const auto e = m_scene.Create();
             glm::vec3 translation{
                 0,
                 3,
                 i * 2,
             };
             glm::vec3 color{ std::rand() % 100 / 100.f, std::rand() % 100 / 100.f, std::rand() % 100 / 100.f };
-            m_scene.Emplace<core::TransformComponent>(e, translation, glm::vec3{ 0 }, glm::vec3{ 1 });
-            m_scene.Emplace<core::PointLightComponent>(e, color);
+            m_scene.get<core::TransformComponent>(lights[i]).SetTranslation(translation);
+            m_scene.get<core::PointLightComponent>(lights[i]).color = color;
         }
     }
 
     // start systems
     {
         m_scene.start<core::ScriptSystem>(core::LogicPhase);
+        m_scene.start<core::TransformSystem>(core::TransformPhase);
+        m_scene.start<core::SpatialIndexSystem>(core::TransformPhase);
         m_scene.start<core::RenderSystem>(core::RenderPhase);
     }
 
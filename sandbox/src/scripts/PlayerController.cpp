@@ -25,18 +25,13 @@ void PlayerController::onUpdate(const float delta)
 
     if (glm::length(dir) == 0) { return; } // no input, can skip all
 
-    glm::mat4 rot{ 1.f };
-    rot = glm::rotate(rot, transform.rotation.x, { 1, 0, 0 });
-    rot = glm::rotate(rot, transform.rotation.y, { 0, 1, 0 });
-    rot = glm::rotate(rot, transform.rotation.z, { 0, 0, 1 });
-
     dir                = glm::normalize(dir);
-    const auto forward = glm::vec3{ rot * glm::vec4(0, 0, -1, 0) };
-    const auto right   = glm::vec3{ rot * glm::vec4(1, 0, 0, 0) };
+    const auto forward = transform.GetRotation() * glm::vec3(0, 0, -1);
+    const auto right   = transform.GetRotation() * glm::vec3(1, 0, 0);
     const auto up      = glm::vec3(0, 1, 0);
 
     glm::vec3 move = dir.x * right + dir.y * up + dir.z * forward;
 
-    transform.translation += move * delta * m_movementSpeed;
+    transform.Translate(move * delta * m_movementSpeed);
 }
 } // namespace siren
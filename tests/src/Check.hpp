@@ -0,0 +1,18 @@
+#pragma once
+
+#include <iostream>
+
+
+namespace siren::tests
+{
+/// @brief The amount of failed checks so far, returned from main() by each test.
+inline int s_failures = 0;
+
+/// @brief Records a failure with the given description if condition does not hold.
+inline void Check(const bool condition, const std::string_view description)
+{
+    if (condition) { return; }
+    std::cerr << "FAILED: " << description << '\n';
+    s_failures++;
+}
+} // namespace siren::tests
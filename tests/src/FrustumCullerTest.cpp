@@ -0,0 +1,148 @@
+#include "Check.hpp"
+
+#include "renderer/FrustumCuller.hpp"
+
+#include <random>
+
+using namespace siren;
+using namespace siren::core;
+using namespace siren::tests;
+
+
+namespace
+{
+/// @brief The frustum enclosing the cube [-1, 1]^3, simple enough to reason about each plane.
+Frustum unitCube()
+{
+    Frustum frustum;
+    frustum.planes = {
+        glm::vec4{ 1, 0, 0, 1 },
+        glm::vec4{ -1, 0, 0, 1 },
+        glm::vec4{ 0, 1, 0, 1 },
+        glm::vec4{ 0, -1, 0, 1 },
+        glm::vec4{ 0, 0, 1, 1 },
+        glm::vec4{ 0, 0, -1, 1 },
+    };
+    return frustum;
+}
+
+AABB box(const glm::vec3& center, const float extent)
+{
+    return AABB{ center - extent, center + extent };
+}
+
+const AABB INSIDE  = box(glm::vec3{ 0.f }, 0.5f);
+const AABB OUTSIDE = box(glm::vec3{ 3.f, 0.f, 0.f }, 0.5f);
+
+/// @brief Sizes covering no SIMD group, only the scalar tail, exactly one group, and groups
+/// followed by a tail.
+constexpr u32 SIZES[] = { 0, 3, 4, 5, 9 };
+
+/// @brief Culls a single outside box at every index among inside boxes, so that it lands in every
+/// SIMD lane as well as in the scalar tail.
+void testLanes()
+{
+    const Frustum frustum = unitCube();
+    for (const u32 size : SIZES) {
+        for (u32 culled = 0; culled < size; culled++) {
+            FrustumCuller culler;
+            Vector<u32> expected;
+            for (u32 i = 0; i < size; i++) {
+                culler.Add(i == culled ? OUTSIDE : INSIDE);
+                if (i != culled) { expected.push_back(i); }
+            }
+
+            Vector<u32> visible{ 42 };
+            culler.Cull(frustum, visible);
+            Check(
+                visible == expected,
+                std::format("size {}: only the box at {} is culled", size, culled)
+            );
+        }
+    }
+}
+
+/// @brief Compares random boxes against the scalar Frustum::Intersects().
+void testRandom()
+{
+    const Frustum frustum = unitCube();
+    std::mt19937 random{ 7 };
+    std::uniform_real_distribution<float> position{ -3.f, 3.f };
+    std::uniform_real_distribution<float> extent{ 0.05f, 1.f };
+
+    for (const u32 size : SIZES) {
+        for (u32 round = 0; round < 100; round++) {
+            FrustumCuller culler;
+            Vector<u32> expected;
+            for (u32 i = 0; i < size; i++) {
+                const AABB bounds = box(
+                    glm::vec3{ position(random), position(random), position(random) },
+                    extent(random)
+                );
+                culler.Add(bounds);
+                if (frustum.Intersects(bounds)) { expected.push_back(i); }
+            }
+
+            Vector<u32> visible;
+            culler.Cull(frustum, visible);
+            Check(visible == expected, std::format("size {}: matches Frustum::Intersects", size));
+        }
+    }
+}
+
+/// @brief Empty bounds, e.g. of meshes without vertices, must never be culled.
+void testEmptyBounds()
+{
+    const Frustum frustum = unitCube();
+    for (const u32 size : SIZES) {
+        FrustumCuller culler;
+        Vector<u32> expected;
+        for (u32 i = 0; i < size; i++) {
+            const bool empty = i % 2 == 0;
+            culler.Add(empty ? AABB{ } : OUTSIDE);
+            if (empty) { expected.push_back(i); }
+        }
+
+        Vector<u32> visible;
+        culler.Cull(frustum, visible);
+        Check(visible == expected, std::format("size {}: empty bounds are visible", size));
+    }
+}
+
+/// @brief Boxes crossing a plane are visible, boxes just beyond it are not.
+void testStraddling()
+{
+    const Frustum frustum = unitCube();
+    const AABB straddling = box(glm::vec3{ 1.f, 0.f, 0.f }, 0.25f);
+    const AABB touching   = box(glm::vec3{ 0.f, -1.25f, 0.f }, 0.25f);
+    const AABB beyond     = box(glm::vec3{ 0.f, 0.f, 1.3f }, 0.25f);
+
+    // five of each, so that every case is tested by the SIMD path and the scalar tail
+    FrustumCuller culler;
+    for (u32 i = 0; i < 5; i++) {
+        culler.Add(straddling);
+        culler.Add(touching);
+        culler.Add(beyond);
+    }
+
+    Vector<u32> visible;
+    culler.Cull(frustum, visible);
+    Vector<u32> expected;
+    for (u32 i = 0; i < 5; i++) {
+        expected.push_back(i * 3);
+        expected.push_back(i * 3 + 1);
+    }
+    Check(visible == expected, "boxes straddling or touching a plane are visible");
+}
+} // namespace
+
+int main()
+{
+    testLanes();
+    testRandom();
+    testEmptyBounds();
+    testStraddling();
+
+    if (s_failures == 0) { std::cout << "FrustumCullerTest passed\n"; }
+    return s_failures == 0 ? 0 : 1;
+}
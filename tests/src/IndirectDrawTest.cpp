@@ -0,0 +1,199 @@
+#include "Check.hpp"
+
+#include "renderer/DrawCommand.hpp"
+
+#include <random>
+
+using namespace siren;
+using namespace siren::core;
+using namespace siren::tests;
+
+
+namespace
+{
+/// @brief Stands in for render state, which BuildIndirectDraws() only compares by address.
+Array<byte, 16> s_state{ };
+
+template <typename T>
+T* fakeState(const size_t index)
+{
+    return reinterpret_cast<T*>(&s_state[index]);
+}
+
+/// @brief A valid command drawing geometry with material, reading its matrix from transformIndex.
+DrawCommand command(const u32 transformIndex, const u32 material, const u32 geometry)
+{
+    return {
+        .transformIndex = transformIndex,
+        .indexCount = 36,
+        .vertices = fakeState<Buffer>(0),
+        .indices = fakeState<Buffer>(1),
+        .pipeline = fakeState<GraphicsPipeline>(2),
+        .material = fakeState<Material>(3 + material),
+        .firstIndex = geometry * 36,
+        .baseVertex = static_cast<i32>(geometry * 24),
+    };
+}
+
+/// @brief A command that is skipped, as it has no material.
+DrawCommand invalid(const u32 transformIndex)
+{
+    DrawCommand cmd = command(transformIndex, 0, 0);
+    cmd.material    = nullptr;
+    return cmd;
+}
+
+/// @brief Transforms whose translation is their index, so that instances can be traced back.
+Vector<glm::mat4> createTransforms(const u32 count)
+{
+    Vector<glm::mat4> transforms(count, glm::mat4{ 1.f });
+    for (u32 i = 0; i < count; i++) { transforms[i][3].x = static_cast<float>(i); }
+    return transforms;
+}
+
+struct Output
+{
+    Vector<glm::mat4> instances;
+    Vector<DrawElementsIndirectCommand> indirect;
+    Vector<DrawBatch> batches;
+    IndirectDrawCounts counts;
+};
+
+Output build(const Vector<DrawCommand>& commands, const Vector<glm::mat4>& transforms)
+{
+    Output output;
+    output.instances.resize(commands.size());
+    output.indirect.resize(commands.size());
+    output.batches.resize(commands.size());
+    output.counts = BuildIndirectDraws(
+        commands,
+        transforms,
+        output.instances,
+        output.indirect,
+        output.batches
+    );
+    return output;
+}
+
+/// @brief Returns the transform index the instance was written from.
+u32 source(const Output& output, const u32 instance)
+{
+    return static_cast<u32>(output.instances[instance][3].x);
+}
+
+void testEmpty()
+{
+    const Output output = build({ }, { });
+    Check(output.counts.indirectDraws == 0, "no commands give no indirect draws");
+    Check(output.counts.batches == 0, "no commands give no batches");
+    Check(output.counts.instances == 0, "no commands give no instances");
+}
+
+void testRuns()
+{
+    const Vector<glm::mat4> transforms = createTransforms(5);
+    // two instances of a mesh, another mesh of the same material, then another material
+    const Output output = build(
+        {
+            command(0, 0, 0),
+            command(1, 0, 0),
+            command(2, 0, 1),
+            command(3, 1, 1),
+            command(4, 1, 1),
+        },
+        transforms
+    );
+
+    Check(output.counts.indirectDraws == 3, "runs of identical commands become one indirect draw");
+    Check(output.counts.batches == 2, "commands sharing state are batched");
+    Check(output.counts.instances == 5, "every command is an instance");
+    Check(output.indirect[0].instanceCount == 2, "first run has two instances");
+    Check(output.indirect[1].baseInstance == 2, "second run starts after the first");
+    Check(output.indirect[2].instanceCount == 2, "last run has two instances");
+    Check(output.batches[0].indirectCount == 2, "first batch holds both meshes of its material");
+    Check(output.batches[1].firstIndirect == 2, "second batch starts at the new material");
+}
+
+void testSkippedCommandInsideRun()
+{
+    const Vector<glm::mat4> transforms = createTransforms(4);
+    const Output output = build(
+        { command(0, 0, 0), invalid(1), command(2, 0, 0), command(3, 0, 0) },
+        transforms
+    );
+
+    Check(output.counts.indirectDraws == 1, "a skipped command does not split a run");
+    Check(output.counts.instances == 3, "a skipped command is no instance");
+    Check(output.indirect[0].instanceCount == 3, "the run holds all valid commands");
+    Check(
+        source(output, 0) == 0 && source(output, 1) == 2 && source(output, 2) == 3,
+        "the run's instances are the matrices of the valid commands only"
+    );
+}
+
+void testLeadingSkippedCommand()
+{
+    const Vector<glm::mat4> transforms = createTransforms(2);
+    const Output output = build({ invalid(0), command(1, 0, 0) }, transforms);
+
+    Check(output.counts.indirectDraws == 1, "commands after a skipped one are drawn");
+    Check(output.indirect[0].baseInstance == 0, "instances start at 0 after a skipped command");
+    Check(source(output, 0) == 1, "the first instance is the first valid command");
+}
+
+/// @brief Every instance drawn by an indirect draw must be the matrix of a valid command drawing
+/// the same geometry, in command order.
+void testRandom()
+{
+    std::mt19937 random{ 7 };
+    for (u32 round = 0; round < 100; round++) {
+        const u32 count                    = random() % 64;
+        const Vector<glm::mat4> transforms = createTransforms(count);
+
+        Vector<DrawCommand> commands;
+        for (u32 i = 0; i < count; i++) {
+            if (random() % 4 == 0) {
+                commands.push_back(invalid(i));
+            } else {
+                commands.push_back(command(i, random() % 2, random() % 2));
+            }
+        }
+        std::ranges::stable_sort(
+            commands,
+            { },
+            [] (const DrawCommand& cmd) { return std::pair{ cmd.material, cmd.firstIndex }; }
+        );
+
+        const Output output = build(commands, transforms);
+        Vector<const DrawCommand*> valid;
+        for (const DrawCommand& cmd : commands) {
+            if (cmd) { valid.push_back(&cmd); }
+        }
+
+        bool matches = output.counts.instances == valid.size();
+        u32 next     = 0;
+        for (u32 i = 0; i < output.counts.indirectDraws && matches; i++) {
+            const DrawElementsIndirectCommand& draw = output.indirect[i];
+            matches &= draw.baseInstance == next;
+            for (u32 instance = 0; instance < draw.instanceCount && matches; instance++) {
+                const DrawCommand& cmd = *valid[next + instance];
+                matches &= source(output, next + instance) == cmd.transformIndex;
+                matches &= cmd.firstIndex == draw.firstIndex && cmd.baseVertex == draw.baseVertex;
+            }
+            next += draw.instanceCount;
+        }
+        matches &= next == valid.size();
+        Check(matches, std::format("random commands, round {}, draw their own matrices", round));
+    }
+}
+} // namespace
+
+int main()
+{
+    testEmpty();
+    testRuns();
+    testSkippedCommandInsideRun();
+    testLeadingSkippedCommand();
+    testRandom();
+    return s_failures;
+}